@@ -14,6 +14,7 @@ message(STATUS "")
 
 OPTION(WITH_C11 "With C++ compiler C11 (ex. cpp0x) features." ON)
 OPTION(WITH_GMP "With Gnu Multiprecision Library (GMP)." OFF)
+OPTION(WITH_OPENMP "With OpenMP (compiler multithread programming) features." OFF)
 OPTION(WITH_QGLVIEWER "With LibQGLViewer for 3D visualization (Qt required)." OFF)
 OPTION(WITH_MAGICK "With GraphicsMagick++." OFF)
 OPTION(WITH_ITK "With Insight Toolkit ITK." OFF)
@@ -34,6 +35,13 @@ ELSE(WITH_GMP)
 message(STATUS "      WITH_GMP          false")
 ENDIF(WITH_GMP)
 
+IF(WITH_OPENMP)
+SET (LIST_OPTION ${LIST_OPTION} [OPENMP]\ )
+message(STATUS "      WITH_OPENMP       true")
+ELSE(WITH_OPENMP)
+message(STATUS "      WITH_OPENMP       false")
+ENDIF(WITH_OPENMP)
+
 IF(WITH_ITK)
 SET (LIST_OPTION ${LIST_OPTION} [ITK]\ )
 message(STATUS "      WITH_ITK          true")
@@ -99,6 +107,25 @@ IF(WITH_GMP)
   ENDIF(GMP_FOUND)
 ENDIF(WITH_GMP)
 
+# -----------------------------------------------------------------------------
+# Look for OpenMP
+# (They are not compulsory).
+# -----------------------------------------------------------------------------
+SET(OPENMP_FOUND_DGTAL 0)
+IF(WITH_OPENMP)
+  FIND_PACKAGE(OpenMP REQUIRED)
+  IF(OPENMP_FOUND)
+    SET(OPENMP_FOUND_DGTAL 1)
+    SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${OpenMP_C_FLAGS}")
+    SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}")
+    SET(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} ${OpenMP_EXE_LINKER_FLAGS}")
+    message(STATUS "OpenMP found." )
+    ADD_DEFINITIONS("-DWITH_OPENMP ")
+  ELSE(OPENMP_FOUND)
+    message(FATAL_ERROR "OpenMP support not available. Check your compiler or disable it." )
+  ENDIF(OPENMP_FOUND)
+ENDIF(WITH_OPENMP)
+
 # -----------------------------------------------------------------------------
 # Look for GraphicsMagic
 # (They are not compulsory).
@@ -149,7 +149,8 @@ except the last one. In this sense, a fraction is a sequence
 
 ### Models
 
-- SternBrocot::Fraction, LighterSternBrocot::Fraction
+- SternBrocot::Fraction, LighterSternBrocot::Fraction,
+  InlineSternBrocot::Fraction
 - also LightSternBrocot::Fraction (but do not use).
 
 ### Notes
@@ -0,0 +1,461 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file InlineSternBrocot.h
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/07/02
+ *
+ * Header file for module InlineSternBrocot.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see LighterSternBrocot.h testInlineSternBrocot.cpp
+ */
+
+#if defined(InlineSternBrocot_RECURSES)
+#error Recursive header files inclusion detected in InlineSternBrocot.h
+#else // defined(InlineSternBrocot_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define InlineSternBrocot_RECURSES
+
+#if !defined InlineSternBrocot_h
+/** Prevents repeated inclusion of headers. */
+#define InlineSternBrocot_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/InputIteratorWithRankOnSequence.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/CSignedInteger.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class InlineSternBrocot
+  /**
+   Description of template class 'InlineSternBrocot' <p> \brief Aim:
+   The Stern-Brocot tree is the tree of irreducible fractions. This
+   class allows to navigate within fractions without storing the tree
+   at all: each fraction stores its own continued fraction.
+
+   The classes SternBrocot, LightSternBrocot and LighterSternBrocot
+   represent a fraction by a pointer to a node of a shared tree, which
+   is built on demand. Each new fraction then allocates nodes, the
+   tree is never freed, and the nodes of a same computation are
+   scattered in memory. Here, a fraction [u_0; u_1, ..., u_k] is a
+   value, which stores the quotients u_0, ..., u_k in an array of
+   fixed capacity N, together with the fraction p_k/q_k itself and
+   the previous convergent p_{k-1}/q_{k-1}. The other convergents are
+   recovered backward by p_{i-2} = p_i - u_i p_{i-1}. Hence, no
+   operation on fractions (father, previousPartial, reduced,
+   getSplitBerstel, etc) allocates memory, and StandardDSLQ0 or
+   Pattern instantiated with InlineSternBrocot::Fraction perform no
+   allocation either (except through begin(), as for the other
+   representations).
+
+   Since the denominators of the convergents grow at least like the
+   Fibonacci numbers, the depth of a fraction whose numerator and
+   denominator are at most 2^63 is at most 92, hence the default
+   capacity N = 96 quotients. An operation that would give a
+   fraction of more than N quotients (e.g. with BigInteger) throws a
+   MemoryException, in release mode too. The conventions (depth and quotient of
+   1/0 and 0/1, reduced fractions of negative depth) are those of
+   LighterSternBrocot. Operations are O(1), except reduced( i ) which
+   is O(i), and inverse() which is O(k).
+
+   This class is not to be instantiated. Use static method
+   InlineSternBrocot::fraction to obtain your fractions.
+
+   @param TInteger the integral type chosen for the fractions.
+
+   @param TQuotient the integral type chosen for the
+   quotients/coefficients or depth (may be "smaller" than TInteger,
+   since they are generally much smaller than the fraction itself).
+
+   @param N the maximal number of quotients of a fraction, i.e. the
+   maximal depth plus 1 (the default value suits 64-bits integers).
+  */
+  template <typename TInteger, typename TQuotient, unsigned int N = 96>
+  class InlineSternBrocot
+  {
+  public:
+    typedef TInteger Integer;
+    typedef TQuotient Quotient;
+    typedef InlineSternBrocot<TInteger,TQuotient,N> Self;
+
+    BOOST_CONCEPT_ASSERT(( CInteger< Integer > ));
+    BOOST_CONCEPT_ASSERT(( CSignedInteger< Quotient > ));
+
+    /// The maximal number of quotients of a fraction.
+    static const unsigned int Capacity = N;
+
+  public:
+
+    /**
+       @brief This fraction is a model of CPositiveIrreducibleFraction.
+
+       It represents a positive irreducible fraction, i.e. some p/q
+       with gcd(p,q)=1. It is an inner class of InlineSternBrocot. It
+       stores its continued fraction [u_0; ..., u_k] with u_k >= 2 for
+       k >= 1, its numerator and denominator and the ones of its
+       previous partial [u_0; ..., u_{k-1}].
+    */
+    class Fraction {
+    public:
+      typedef TInteger Integer;
+      typedef TQuotient Quotient;
+      typedef InlineSternBrocot<TInteger, TQuotient, N> SternBrocotTree;
+      typedef typename SternBrocotTree::Fraction Self;
+      typedef typename NumberTraits<Integer>::UnsignedVersion UnsignedInteger;
+      typedef std::pair<Quotient, Quotient> Value;
+      typedef std::vector<Quotient> CFracSequence;
+      typedef InputIteratorWithRankOnSequence<CFracSequence,Quotient> ConstIterator;
+
+      // --------------------- std types ------------------------------
+      typedef Value value_type;
+      typedef ConstIterator const_iterator;
+      typedef const value_type & const_reference;
+
+    private:
+      /// the numerator p_k.
+      Integer myP;
+      /// the denominator q_k.
+      Integer myQ;
+      /// the numerator p_{k-1} of the previous partial.
+      Integer myPP;
+      /// the denominator q_{k-1} of the previous partial.
+      Integer myQP;
+      /// the depth k (-1 for 1/0).
+      Quotient myK;
+      /// the quotients u_0, ..., u_k.
+      Quotient myU[ N ];
+
+    public:
+      /**
+          Creates the fraction aP/aQ. Complexity is in O(n) where n is the depth
+          of continued fraction of aP/aQ.
+
+          @param aP the numerator (>=0)
+          @param aQ the denominator (>=0)
+      */
+      Fraction( Integer aP, Integer aQ );
+
+      /**
+          Creates the fraction aP/aQ, as Fraction( aP, aQ ).
+
+          @param aP the numerator (>=0)
+          @param aQ the denominator (>=0)
+
+          @param start unused in this representation.
+      */
+      Fraction( Integer aP, Integer aQ, const Fraction & start );
+
+      /// Only the null pointer of this type may be given to the
+      /// default constructor.
+      struct Null;
+
+      /**
+	 Default constructor. Creates the null fraction 0/0. As for
+	 the other representations, Fraction( 0 ) is the null fraction.
+      */
+      Fraction( const Null* = 0 );
+
+      /**
+         Copy constructor. Only the k+1 quotients are copied.
+         @param other the object to clone.
+      */
+      Fraction( const Self & other );
+
+      /**
+         Assignment. Only the k+1 quotients are copied.
+         @param other the object to clone.
+         @return a reference to 'this'.
+      */
+      Self& operator=( const Self & other );
+
+      /// @return 'true' iff it is the null fraction 0/0.
+      bool null() const;
+      /// @return its numerator;
+      Integer p() const;
+      /// @return its denominator;
+      Integer q() const;
+      /// @return its quotient (last coefficient of its continued fraction).
+      Quotient u() const;
+      /// @return its depth (1+number of coefficients of its continued fraction).
+      Quotient k() const;
+
+      /// @return its left descendant.
+      Fraction left() const;
+      /// @return its right descendant.
+      Fraction right() const;
+      /// @return 'true' if it is an even fraction, i.e. its depth k() is even.
+      bool even() const;
+      /// @return 'true' if it is an odd fraction, i.e. its depth k() is odd.
+      bool odd() const;
+
+      /**
+	 @return the father of this fraction in O(1), ie [u0,...,uk]
+	 => [u0,...,uk - 1]
+      */
+      Fraction father() const;
+      /**
+         @param m a quotient between 1 and uk-1.
+	 @return the fraction [u_0, ..., u_{n-1},m]
+      */
+      Fraction father( Quotient m ) const;
+      /**
+	 @return the previous partial of this fraction in O(1), ie
+	 [u0,...,u{k-1},uk] => [u0,...,u{k-1}]. Otherwise said, it is
+	 its ascendant with a smaller depth.
+      */
+      Fraction previousPartial() const;
+      /**
+	 @return the inverse of this fraction in O(k), ie [u0,...,uk]
+	 => [0,u0,...,uk] or [0,u0,...,uk] => [u0,...,uk].
+      */
+      Fraction inverse() const;
+      /**
+	 @param kp the chosen depth of the partial fraction (kp <= k()).
+
+	 @return the partial fraction of depth kp, ie. [u0,...,uk] =>
+	 [u0,...,ukp]
+      */
+      Fraction partial( Quotient kp ) const;
+      /**
+	 @param i a positive integer smaller or equal to k()+2.
+
+	 @return the partial fraction of depth k()-i in O(i), ie.
+	 [u0,...,uk] => [u0,...,u{k-i}], written [u0,...,u{k-i-1}+1]
+	 if u{k-i} = 1 (as in SternBrocot).
+      */
+      Fraction reduced( Quotient i ) const;
+
+      /**
+         Modifies this fraction \f$[u_0,...,u_k]\f$ to obtain the
+         fraction \f$[u_0,...,u_k,m]\f$. The depth of the quotient
+         must be given, since continued fractions have two writings
+         \f$[u_0,...,u_k]\f$ and \f$[u_0,...,u_k - 1, 1]\f$.
+
+         Useful to create output iterators, for instance with
+
+         @code
+         typedef ... Fraction;
+         Fraction f;
+         std::back_insert_iterator<Fraction> itout = std::back_inserter( f );
+         @endcode
+
+         @param quotient the pair \f$(m,k+1)\f$.
+      */
+      void push_back( const std::pair<Quotient, Quotient> & quotient );
+
+      /**
+         Modifies this fraction \f$[u_0,...,u_k]\f$ to obtain the
+         fraction \f$[u_0,...,u_k,m]\f$. The depth of the quotient
+         must be given, since continued fractions have two writings
+         \f$[u_0,...,u_k]\f$ and \f$[u_0,...,u_k - 1, 1]\f$.
+
+         See push_back for creating output iterators.
+
+         @param quotient the pair \f$(m,k+1)\f$.
+      */
+      void pushBack( const std::pair<Quotient, Quotient> & quotient );
+
+      /**
+	 Splitting formula, O(1) time complexity. This fraction should
+	 not be 0/1 or 1/0. NB: 'this' = [f1] \oplus [f2].
+
+	 @param f1 (returns) the left part of the split.
+	 @param f2 (returns) the right part of the split.
+      */
+      void getSplit( Fraction & f1, Fraction & f2 ) const;
+
+      /**
+	 Berstel splitting formula, O(1) time complexity. This
+	 fraction should not be 0/1 or 1/0. NB: 'this' = nb1*[f1]
+	 \oplus nb2*[f2]. Also, if 'this->k' is even then nb1=1,
+	 otherwise nb2=1.
+
+	 @param f1 (returns) the left part of the split (left pattern).
+	 @param nb1 (returns) the number of repetition of the left pattern
+	 @param f2 (returns) the right part of the split (right pattern).
+	 @param nb2 (returns) the number of repetition of the right pattern
+      */
+      void getSplitBerstel( Fraction & f1, Quotient & nb1,
+			    Fraction & f2, Quotient & nb2 ) const;
+
+      /**
+	 @param quotients (returns) the coefficients of the continued
+	 fraction of 'this'.
+      */
+      void getCFrac( std::vector<Quotient> & quotients ) const;
+
+      /**
+         @param p1 a numerator.
+         @param q1 a denominator.
+         @return 'true' if this is the fraction p1/q1.
+      */
+      bool equals( Integer p1, Integer q1 ) const;
+
+      /**
+         @param p1 a numerator.
+         @param q1 a denominator.
+         @return 'true' if this is < to the fraction p/q.
+      */
+      bool lessThan( Integer p1, Integer q1 ) const;
+
+      /**
+         @param p1 a numerator.
+         @param q1 a denominator.
+         @return 'true' if this is > to the fraction p1/q1.
+      */
+      bool moreThan( Integer p1, Integer q1 ) const;
+
+      /**
+         @param other any fraction.
+         @return 'true' iff this is equal to other.
+      */
+      bool operator==( const Fraction & other ) const;
+
+      /**
+         @param other any fraction.
+         @return 'true' iff this is different from other.
+      */
+      bool operator!=( const Fraction & other ) const;
+
+      /**
+         @param other any fraction.
+         @return 'true' iff this is < to other.
+      */
+      bool operator<( const Fraction & other ) const;
+
+      /**
+         @param other any fraction.
+         @return 'true' iff this is > to other.
+      */
+      bool operator>( const Fraction & other ) const;
+
+      /**
+       * Writes/Displays the fraction on an output stream.
+       * @param out the output stream where the object is written.
+       */
+      void selfDisplay ( std::ostream & out ) const;
+
+      /**
+         @return a const iterator pointing on the beginning of the sequence of quotients of this fraction.
+         NB: O(k) operation, which allocates the sequence.
+      */
+      ConstIterator begin() const;
+
+      /**
+         @return a const iterator pointing after the end of the sequence of quotients of this fraction.
+         NB: O(1) operation.
+      */
+      ConstIterator end() const;
+
+    private:
+      /// Becomes 1/0.
+      void setOneOverZero();
+      /// Becomes [u_0, ..., u_k, m].
+      void pushQuotient( Quotient m );
+      /// Becomes [u_0, ..., u_k - 1, v], for v >= 2, without
+      /// simplification of a quotient u_k - 1 = 1.
+      void child( Quotient v );
+      /// Rewrites [u_0, ..., u_{k-1}, 1] as [u_0, ..., u_{k-1} + 1]
+      /// if k >= 1.
+      void simplify();
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /** The fraction 0/1 */
+    static Fraction zeroOverOne();
+
+    /** The fraction 1/0 */
+    static Fraction oneOverZero();
+
+    /** The fraction 1/1 */
+    static Fraction oneOverOne();
+
+    /**
+	Any fraction p/q. Complexity is in O(n) where n is the depth
+	of continued fraction of p/q.
+
+	@param p the numerator (>=0)
+	@param q the denominator (>=0)
+
+	@return the corresponding fraction.
+    */
+    static Fraction fraction( Integer p, Integer q );
+
+    /**
+	Any fraction p/q, as fraction( p, q ).
+
+	@param p the numerator (>=0)
+	@param q the denominator (>=0)
+
+	@param ancestor unused in this representation.
+
+	@return the corresponding fraction.
+    */
+    static Fraction fraction( Integer p, Integer q, const Fraction & ancestor );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the fraction on an output stream.
+     * @param out the output stream where the object is written.
+     * @param f the fraction to display.
+     */
+    static void display ( std::ostream & out, const Fraction & f );
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Constructor. Hidden since this class is not to be instantiated.
+     */
+    InlineSternBrocot();
+
+  }; // end of class InlineSternBrocot
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/InlineSternBrocot.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined InlineSternBrocot_h
+
+#undef InlineSternBrocot_RECURSES
+#endif // else defined(InlineSternBrocot_RECURSES)
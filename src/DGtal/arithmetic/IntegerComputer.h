@@ -51,6 +51,78 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+#ifdef __SIZEOF_INT128__
+    /// 128-bit signed integer (GCC and Clang on 64-bit targets).
+    __extension__ typedef __int128 Int128;
+#endif
+
+    /// @return the number of trailing zero bits of \a x, x != 0.
+    unsigned int countTrailingZeros( uint32_t x );
+    /// @return the number of trailing zero bits of \a x, x != 0.
+    unsigned int countTrailingZeros( uint64_t x );
+
+    /**
+       Description of template class 'FixedWidthIntegerComputer' <p>
+       \brief Aim: Fast paths of IntegerComputer for a signed integer
+       type of fixed width. Divisions are branch-free, the gcd is
+       the binary (Stein) one, cross products are computed in a type
+       twice as wide, so that overflows are reported, and the
+       extended Euclid algorithm only uses local variables.
+
+       @tparam TInteger a signed fixed-width integer type.
+       @tparam TUnsigned the unsigned version of TInteger.
+       @tparam TWide a signed integer type twice as wide as TInteger.
+    */
+    template <typename TInteger, typename TUnsigned, typename TWide>
+    struct FixedWidthIntegerComputer
+    {
+      typedef TagTrue Enabled;
+      typedef TInteger Integer;
+
+      /// @return the floor value of na/nb.
+      static Integer floorDiv( Integer na, Integer nb );
+      /// @return the ceil value of na/nb.
+      static Integer ceilDiv( Integer na, Integer nb );
+      /// Computes the floor \a fl and ceil \a ce values of na/nb.
+      static void getFloorCeilDiv( Integer & fl, Integer & ce,
+                                   Integer na, Integer nb );
+      /// @return the (non-negative) gcd of \a a and \a b.
+      static Integer gcd( Integer a, Integer b );
+      /// Computes \a cp = ux * vy - uy * vx.
+      /// @return 'false' iff the cross product overflows Integer.
+      static bool getCrossProduct( Integer & cp, Integer ux, Integer uy,
+                                   Integer vx, Integer vy );
+      /// Computes \a g = gcd( a, b ) and a Bezout pair (x,y) such
+      /// that a x + b y = g.
+      static void getExtendedGcd( Integer & g, Integer & x, Integer & y,
+                                  Integer a, Integer b );
+    };
+
+    /**
+       Fast paths of IntegerComputer<TInteger>. There is none by
+       default: IntegerComputer uses its generic methods.
+    */
+    template <typename TInteger>
+    struct IntegerComputerFastPath
+    {
+      typedef TagFalse Enabled;
+    };
+
+    template <>
+    struct IntegerComputerFastPath<int32_t>
+      : public FixedWidthIntegerComputer<int32_t, uint32_t, int64_t>
+    {};
+
+#ifdef __SIZEOF_INT128__
+    template <>
+    struct IntegerComputerFastPath<int64_t>
+      : public FixedWidthIntegerComputer<int64_t, uint64_t, Int128>
+    {};
+#endif
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class IntegerComputer
   /**
@@ -67,6 +139,13 @@ namespace DGtal
      To be thread-safe, each thread \b must instantiate an
      IntegerComputer.
 
+     With \c int32_t and \c int64_t (the latter when the compiler
+     provides 128-bit integers), floorDiv, ceilDiv, getFloorCeilDiv,
+     gcd, getGcd, reduce, crossProduct and extendedEuclid use the
+     fast paths of detail::FixedWidthIntegerComputer, which do not
+     touch the member data, and getCheckedCrossProduct reports
+     overflows.
+
      It is a model of boost::CopyConstructible,
      boost::DefaultConstructible, boost::Assignable. All its member data are
      \b mutable.
@@ -333,6 +412,20 @@ xs
     void getCrossProduct( Integer & cp, 
                           const Vector2I & u, const Vector2I & v) const;
 
+    /**
+       Computes the cross product of \a u and \a v, and checks that
+       it is representable by Integer. Overflows are only detected
+       for integer types with a fast path (\c int32_t, \c int64_t);
+       for other types, the returned value is always 'true'.
+
+       @param cp (returns) the cross product of \a u and \a v.
+       @param u any vector in Z2.
+       @param v any vector in Z2.
+       @return 'false' iff the cross product overflows.
+     */
+    bool getCheckedCrossProduct( Integer & cp, 
+                                 const Vector2I & u, const Vector2I & v ) const;
+
     /**
        Computes and returns the dot product of \a u and \a v.
 
@@ -498,7 +591,39 @@ xs
 
     // ------------------------- Hidden services ------------------------------
   protected:
-
+    typedef detail::IntegerComputerFastPath<Integer> FastPath;
+    typedef typename FastPath::Enabled HasFastPath;
+
+    // Each method is dispatched on whether Integer has a fast path
+    // (TagTrue) or not (TagFalse, the generic code).
+    Integer floorDiv( IntegerParamType na, IntegerParamType nb, TagTrue ) const;
+    Integer floorDiv( IntegerParamType na, IntegerParamType nb, TagFalse ) const;
+    Integer ceilDiv( IntegerParamType na, IntegerParamType nb, TagTrue ) const;
+    Integer ceilDiv( IntegerParamType na, IntegerParamType nb, TagFalse ) const;
+    void getFloorCeilDiv( Integer & fl, Integer & ce,
+                          IntegerParamType na, IntegerParamType nb, 
+                          TagTrue ) const;
+    void getFloorCeilDiv( Integer & fl, Integer & ce,
+                          IntegerParamType na, IntegerParamType nb, 
+                          TagFalse ) const;
+    Integer gcd( IntegerParamType a, IntegerParamType b, TagTrue ) const;
+    Integer gcd( IntegerParamType a, IntegerParamType b, TagFalse ) const;
+    void getGcd( Integer & g, IntegerParamType a, IntegerParamType b, 
+                 TagTrue ) const;
+    void getGcd( Integer & g, IntegerParamType a, IntegerParamType b, 
+                 TagFalse ) const;
+    Integer crossProduct( const Vector2I & u, const Vector2I & v, 
+                          TagTrue ) const;
+    Integer crossProduct( const Vector2I & u, const Vector2I & v, 
+                          TagFalse ) const;
+    bool getCheckedCrossProduct( Integer & cp, const Vector2I & u, 
+                                 const Vector2I & v, TagTrue ) const;
+    bool getCheckedCrossProduct( Integer & cp, const Vector2I & u, 
+                                 const Vector2I & v, TagFalse ) const;
+    Vector2I extendedEuclid( IntegerParamType a, IntegerParamType b, 
+                             IntegerParamType c, TagTrue ) const;
+    Vector2I extendedEuclid( IntegerParamType a, IntegerParamType b, 
+                             IntegerParamType c, TagFalse ) const;
 
     // ------------------------- Internals ------------------------------------
   private:
@@ -106,7 +106,7 @@ namespace DGtal
        Constructor from fraction.
        @param f any fraction (default is null pattern).
      */
-    Pattern( Fraction f = Fraction( 0 ) );
+    Pattern( const Fraction & f = Fraction( 0 ) );
 
     /**
        Constructor from numerator / denominator.
@@ -141,7 +141,7 @@ namespace DGtal
     std::string rEs( const std::string & seps = "(|)" ) const;
 
     /// @return the slope of this pattern, an irreducible fraction
-    Fraction slope() const;
+    const Fraction & slope() const;
 
     /// @return the digital length of the pattern, i.e. slope.p() + slope.q().
     Integer length() const;
@@ -43,6 +43,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
 #include "DGtal/arithmetic/Pattern.h"
@@ -218,7 +220,7 @@ namespace DGtal
        @param aSlope the slope a/b, where gcd(a,b)=1
        @param aMu the shift to origin.
     */
-    StandardDSLQ0( Fraction aSlope, IntegerParamType aMu );
+    StandardDSLQ0( const Fraction & aSlope, IntegerParamType aMu );
 
     /**
        Creates the DSL(a/g,b/g,mu), where g = gcd( a, b).
@@ -234,7 +236,7 @@ namespace DGtal
     bool operator()( const Point & p ) const;
 
     /// @return the slope of this DSL, an irreducible fraction
-    Fraction slope() const;
+    const Fraction & slope() const;
 
     /// @return the shift to origin, which is also the lower
     /// diopantine constraint.
@@ -307,6 +309,43 @@ namespace DGtal
     */
     Self reversedSmartDSS( const Point & A, const Point & B ) const;
 
+    /**
+       Batch version of reversedSmartDSS( const Point & A, const Point & B ).
+       Computes the exact characteristics of each subsegment [A,B] of
+       this DSL given in the range [itb,ite).
+
+       Translating [A,B] by a period of this DSL translates its
+       minimal DSL. Each subsegment is thus moved to the pattern
+       starting at U(), the moved subsegments are sorted so that each
+       distinct one is computed once, and the results are moved
+       back. This pays off when many subsegments are translated from
+       each other, like sliding windows along a DSL whose period is
+       shorter than the range. When DGtal is built with OpenMP
+       (WITH_OPENMP), distinct subsegments may be computed by several
+       threads, which requires a thread-safe fraction (e.g.
+       SternBrocot or InlineSternBrocot, but not LightSternBrocot or
+       LighterSternBrocot).
+
+       @tparam TInputIterator a model of input iterator whose value
+       type is std::pair<Point,Point>.
+       @tparam TOutputIterator a model of output iterator on Self.
+
+       @param itb begin of the range of pairs (A,B), where A and B
+       belong to this DSL and A < B.
+       @param ite end of the range of pairs (A,B).
+       @param out the output iterator where the minimal DSLs are
+       written, in the order of the range.
+       @param aNbThreads the number of threads, 0 meaning the number
+       of available threads (default 1, ie. sequential).
+
+       @return the output iterator after the last written DSL.
+       @see reversedSmartDSS( const Point & A, const Point & B )
+    */
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator reversedSmartDSS( TInputIterator itb, TInputIterator ite,
+                                      TOutputIterator out,
+                                      unsigned int aNbThreads = 1 ) const;
+
     /**
        Algorithm ReversedSmartDSS. See M. Said and J.-O. Lachaud,
        DGCI2010.
@@ -389,8 +428,31 @@ namespace DGtal
     
     // ------------------------- Internals ------------------------------------
   private:
-    static Fraction deepest( Fraction f1, Fraction f2, Fraction f3 );
-    static Fraction deepest( Fraction f1, Fraction f2 );
+    /// A subsegment [A,B] of a batch of reversedSmartDSS queries,
+    /// once translated so that its first upper leaning point U1 is
+    /// U().
+    struct SubsegmentQuery
+    {
+      /// position of A and B after U1 and distance from U1 to U2.
+      Integer posA, posB, dU;
+      /// index of the query in the batch.
+      std::size_t index;
+      bool operator<( const SubsegmentQuery & other ) const
+      {
+        return ( dU < other.dU )
+          || ( ( dU == other.dU ) && ( ( posA < other.posA )
+          || ( ( posA == other.posA ) && ( posB < other.posB ) ) ) );
+      }
+      bool sameSubsegment( const SubsegmentQuery & other ) const
+      {
+        return ( dU == other.dU ) && ( posA == other.posA )
+          && ( posB == other.posB );
+      }
+    };
+
+    static const Fraction & deepest( const Fraction & f1, const Fraction & f2,
+                                     const Fraction & f3 );
+    static const Fraction & deepest( const Fraction & f1, const Fraction & f2 );
   }; // end of class StandardDSLQ0
 
 
@@ -54,6 +54,41 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+       Atomic operations used to share a SternBrocot tree between
+       threads (GCC/clang builtins or MSVC intrinsics).
+    */
+    struct SternBrocotAtomic
+    {
+      /// @return the pointer *ptr, read with acquire semantics.
+      template <typename T>
+      static T* load( T* const * ptr );
+
+      /// Writes the pointer \a value in *ptr with release semantics.
+      template <typename T>
+      static void store( T** ptr, T* value );
+
+      /**
+         Replaces *ptr by \a value if it is \a expected (full barrier).
+         @return the former value of *ptr.
+      */
+      template <typename T>
+      static T* compareAndSwap( T** ptr, T* expected, T* value );
+
+      /// Adds \a value to *ptr. @return the former value of *ptr.
+      static std::size_t fetchAndAdd( std::size_t* ptr, std::size_t value );
+
+      /**
+         Replaces *ptr by \a value if it is \a expected (full barrier).
+         @return the former value of *ptr.
+      */
+      static std::size_t compareAndSwap( std::size_t* ptr, std::size_t expected,
+                                         std::size_t value );
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class SternBrocot
   /**
@@ -68,6 +103,16 @@ namespace DGtal
    duplicate it. Use static method SternBrocot::fraction to obtain
    your fractions.
 
+   The tree may be shared by several threads. The nodes created on
+   demand are taken from an arena of chunks, which grow geometrically
+   and are never moved, so that a node is never freed before the
+   tree. Two threads may create the same descendants at the same
+   time: the descendants are published by an atomic compare-and-swap
+   on the left descendant of their father, the nodes of the thread
+   that fails being lost in the arena. The nodes are never modified
+   afterwards, except for the right descendant, which is only a
+   cache of the inverse of the left descendant of the inverse.
+
    @param TInteger the integral type chosen for the fractions.
 
    @param TQuotient the integral type chosen for the
@@ -441,7 +486,9 @@ namespace DGtal
      */
     bool isValid() const;
 
-    /// The total number of fractions in the current tree.
+    /// The total number of fractions in the current tree. It is
+    /// updated under a lock, and should be read when no other thread
+    /// creates fractions.
     Quotient nbFractions;
 
     // ------------------------- Protected Datas ------------------------------
@@ -455,6 +502,18 @@ namespace DGtal
     Node* myOneOverZero;
     Node* myOneOverOne;
 
+    /// Number of nodes of the first chunk of the arena.
+    static const std::size_t ChunkBase = 1024;
+    /// Maximal number of chunks (the i-th one has ChunkBase*2^i nodes).
+    static const unsigned int MaxChunks = 48;
+    /// The chunks of the arena (0 if not allocated yet).
+    Node* myChunks[ MaxChunks ];
+    /// The number of nodes taken from the arena.
+    std::size_t myNbNodes;
+    /// Spin lock (0 or 1) protecting nbFractions, whose type may not
+    /// be updated atomically.
+    std::size_t myNbFractionsLock;
+
     // ------------------------- Hidden services ------------------------------
   private:
 
@@ -478,6 +537,13 @@ namespace DGtal
      */
     SternBrocot & operator= ( const SternBrocot & other );
 
+    /**
+       Takes two consecutive nodes from the arena (thread-safe). The
+       nodes are not constructed.
+       @return a pointer on the first node.
+    */
+    Node* allocatePair();
+
     // ------------------------- Internals ------------------------------------
   private:
 
@@ -0,0 +1,268 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchLengthEstimator.h
+ * @brief Estimates the lengths of many digital curves with the same
+ * length estimator, in parallel if possible.
+ *
+ * @author Tristan Roussillon (\c
+ * tristan.roussillon@liris.cnrs.fr ) Laboratoire d'InfoRmatique en
+ * Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS,
+ * France
+ *
+ * @date 2012/06/26
+ *
+ * Header file for module BatchLengthEstimator.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testBatchLengthEstimator.cpp
+ */
+
+#if defined(BatchLengthEstimator_RECURSES)
+#error Recursive header files inclusion detected in BatchLengthEstimator.h
+#else // defined(BatchLengthEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchLengthEstimator_RECURSES
+
+#if !defined BatchLengthEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define BatchLengthEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/estimation/L1LengthEstimator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /**
+     * Initializes a length estimator of type @a TLengthEstimator
+     * on a range: init( h, itb, ite, isClosed ).
+     */
+    template <typename TLengthEstimator>
+    struct LengthEstimatorInitializer
+    {
+      template <typename ConstIterator>
+      static void init( TLengthEstimator & e, const double h,
+                        const ConstIterator & itb, const ConstIterator & ite,
+                        const bool & isClosed )
+      {
+        e.init( h, itb, ite, isClosed );
+      }
+    };
+
+    /**
+     * Specialization for L1LengthEstimator, whose init() has no
+     * closedness parameter.
+     */
+    template <typename TConstIterator>
+    struct LengthEstimatorInitializer< L1LengthEstimator<TConstIterator> >
+    {
+      static void init( L1LengthEstimator<TConstIterator> & e, const double h,
+                        const TConstIterator & itb, const TConstIterator & ite,
+                        const bool & /*isClosed*/ )
+      {
+        e.init( h, itb, ite );
+      }
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchLengthEstimator
+  /**
+   * Description of template class 'BatchLengthEstimator' <p>
+   * \brief Aim: estimates the lengths of a collection of digital
+   * curves with a global length estimator, like L1LengthEstimator,
+   * BLUELocalLengthEstimator, RosenProffittLocalLengthEstimator,
+   * DSSLengthEstimator, MLPLengthEstimator or FPLengthEstimator.
+   *
+   * When DGtal is built with OpenMP (WITH_OPENMP), the curves are
+   * dispatched to several threads, each of them using its own
+   * instance of the estimator, which is default-constructed (a
+   * TwoStepLocalLengthEstimator with other weights thus has to be
+   * wrapped into a default-constructible class, as
+   * BLUELocalLengthEstimator).
+   *
+   * Each curve is given by a pair of iterators or circulators.
+   * The time spent on each curve is measured and summed up
+   * in a Statistics object.
+   *
+   * @code
+   * typedef GridCurve<KSpace>::PointsRange::ConstIterator ConstIterator;
+   * BatchLengthEstimator< DSSLengthEstimator<ConstIterator> > batch;
+   * std::vector<BatchLengthEstimator< DSSLengthEstimator<ConstIterator> >::Range> ranges;
+   * //... for each curve c: ranges.push_back( std::make_pair( c.begin(), c.end() ) );
+   * std::vector<double> lengths;
+   * batch.eval( h, ranges, true, lengths );
+   * trace.info() << batch.statistics() << std::endl;
+   * @endcode
+   *
+   * @tparam TLengthEstimator a default-constructible model of
+   * CGlobalCurveGeometricEstimator.
+   */
+  template <typename TLengthEstimator>
+  class BatchLengthEstimator
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TLengthEstimator LengthEstimator;
+    typedef typename LengthEstimator::ConstIterator ConstIterator;
+    typedef typename LengthEstimator::Quantity Quantity;
+    /// range of one curve
+    typedef std::pair<ConstIterator,ConstIterator> Range;
+
+    /**
+     * Timing statistics of the last call to eval().
+     * Times are given in milliseconds (wall-clock time with OpenMP,
+     * processor time otherwise).
+     */
+    struct Statistics
+    {
+      /// number of curves
+      unsigned int nbRanges;
+      /// number of threads
+      unsigned int nbThreads;
+      /// time of the whole batch
+      double totalTime;
+      /// sum of the times spent on each curve
+      double sumTime;
+      /// shortest time spent on a curve
+      double minTime;
+      /// longest time spent on a curve
+      double maxTime;
+
+      Statistics();
+
+      /**
+       * @return the mean time spent on a curve.
+       */
+      double meanTime() const;
+
+      /**
+       * Writes/Displays the object on an output stream.
+       * @param out the output stream where the object is written.
+       */
+      void selfDisplay ( std::ostream & out ) const;
+
+      friend std::ostream&
+      operator<< ( std::ostream & out, const Statistics & object )
+      {
+        object.selfDisplay( out );
+        return out;
+      }
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default Constructor.
+     */
+    BatchLengthEstimator();
+
+    /**
+     * Destructor.
+     */
+    ~BatchLengthEstimator();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Estimates the length of each curve of @a ranges.
+     * Complexity: sum of the complexities of the estimations,
+     * divided between the threads.
+     *
+     * @param h grid size (must be >0).
+     * @param ranges the curves to measure
+     * @param isClosed true if the curves are closed.
+     * @param lengths (returns) the lengths, in the order of @a ranges.
+     * @param aNbThreads number of threads, 0 to let OpenMP decide
+     * (ignored without OpenMP).
+     */
+    void eval( const double h, const std::vector<Range> & ranges,
+               const bool & isClosed, std::vector<Quantity> & lengths,
+               unsigned int aNbThreads = 0 );
+
+    /**
+     * @return the timing statistics of the last call to eval().
+     */
+    const Statistics & statistics() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Statistics of the last batch.
+    Statistics myStatistics;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @return the current time in milliseconds.
+     */
+    static double currentTime();
+
+  }; // end of class BatchLengthEstimator
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchLengthEstimator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchLengthEstimator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchLengthEstimator<T> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/estimation/BatchLengthEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchLengthEstimator_h
+
+#undef BatchLengthEstimator_RECURSES
+#endif // else defined(BatchLengthEstimator_RECURSES)
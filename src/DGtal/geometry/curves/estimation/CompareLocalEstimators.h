@@ -45,6 +45,8 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <iterator>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Statistic.h"
 
@@ -80,6 +82,18 @@ namespace DGtal
     typedef Statistic<double> OutputVectorStatistic;
     
     ///@todo Assert firstestimator::Quantity==secondestimator::Quantity
+
+    /**
+     * L1 (mean of the absolute values), L2 (root mean square) and
+     * Linf (max of the absolute values) norms of the errors.
+     */
+    struct ErrorNorms
+    {
+      unsigned int samples;
+      double l1;
+      double l2;
+      double linf;
+    };
     
     // ----------------------- Interface --------------------------------------
   public:
@@ -208,6 +222,225 @@ namespace DGtal
       return stats;
     }
     
+    // ------------------------- Whole range services ------------------------
+
+    /**
+     * Evaluates both estimators on the whole range [itb,ite) with
+     * their range eval() method, into contiguous buffers. Compared to
+     * one call to eval(it) per point, this avoids the per point
+     * overhead, which is linear for some estimators.
+     *
+     * @pre both estimators must have been initialised with the same
+     * parameters (geometry, resolution h, ...).
+     *
+     * @param aFirstEstimator the first estimator.
+     * @param aSecondEstimator the second estimator.
+     * @param itb starting point of the comparison.
+     * @param ite ending point of the comparison.
+     * @param firstValues (returns) the values of the first estimator.
+     * @param secondValues (returns) the values of the second estimator.
+     * @param inParallel if true and if DGtal is built with OpenMP
+     * (WITH_OPENMP), the two estimators are evaluated concurrently
+     * (they must then be two different objects).
+     */
+    static
+    void
+    evalRanges(FirstEstimator & aFirstEstimator,
+               SecondEstimator & aSecondEstimator,
+               const ConstIterator & itb,
+               const ConstIterator & ite,
+               std::vector<Quantity> & firstValues,
+               std::vector<Quantity> & secondValues,
+               const bool inParallel = false)
+    {
+      ASSERT( aFirstEstimator.isValid());
+      ASSERT( aSecondEstimator.isValid());
+      firstValues.clear();
+      secondValues.clear();
+      ASSERT( ( !inParallel )
+              || ( (void*) &aFirstEstimator != (void*) &aSecondEstimator ) );
+#ifdef WITH_OPENMP
+#pragma omp parallel sections if(inParallel)
+#endif
+      {
+#ifdef WITH_OPENMP
+#pragma omp section
+#endif
+        aFirstEstimator.eval(itb, ite, std::back_inserter(firstValues));
+#ifdef WITH_OPENMP
+#pragma omp section
+#endif
+        aSecondEstimator.eval(itb, ite, std::back_inserter(secondValues));
+      }
+      ASSERT( firstValues.size() == secondValues.size() );
+    }
+
+    /**
+     * Return a statistic on the error (difference) between two
+     * sequences of values, as compare() does for estimators, and
+     * the norms of these errors.
+     *
+     * @param firstValues the values of the first estimator.
+     * @param secondValues the values of the second estimator
+     * (same size).
+     * @param norms (returns) the norms of the errors.
+     * @param storeSamples if true, the instance of Statistic will
+     * store all the values.
+     * @return the statistic of differences between the two sequences.
+     */
+    static
+    OutputStatistic
+    compareValues(const std::vector<Quantity> & firstValues,
+                  const std::vector<Quantity> & secondValues,
+                  ErrorNorms & norms,
+                  const bool storeSamples = false)
+    {
+      ASSERT( firstValues.size() == secondValues.size() );
+      const unsigned int n = firstValues.size();
+      std::vector<Quantity> errors( n );
+      for (unsigned int i = 0; i < n; ++i)
+        errors[ i ] = firstValues[ i ] - secondValues[ i ];
+
+      OutputStatistic stats(storeSamples);
+      stats.addValues( errors.begin(), errors.end() );
+      stats.terminate();
+      computeNorms( errors, norms );
+      return stats;
+    }
+
+    /**
+     * Return a statistic on the angular error between two sequences
+     * of vectors, as compareVectors() does for estimators, and the
+     * norms of these errors.
+     *
+     * @param firstValues the values of the first estimator.
+     * @param secondValues the values of the second estimator
+     * (same size).
+     * @param norms (returns) the norms of the errors.
+     * @param storeSamples if true, the instance of Statistic will
+     * store all the values.
+     * @return the statistic of angular errors between the two sequences.
+     */
+    static
+    OutputVectorStatistic
+    compareVectorValues(const std::vector<Quantity> & firstValues,
+                        const std::vector<Quantity> & secondValues,
+                        ErrorNorms & norms,
+                        const bool storeSamples = false)
+    {
+      ASSERT( firstValues.size() == secondValues.size() );
+      const unsigned int n = firstValues.size();
+      std::vector<double> errors( n );
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          const Quantity & v1 = firstValues[ i ];
+          const Quantity & v2 = secondValues[ i ];
+          ASSERT( v1.norm() != 0.0 );
+          ASSERT( v2.norm() != 0.0 );
+          double ndot = (double) v1.dot(v2)
+            / ( (double) ( v1.norm() * v2.norm() ) );
+          errors[ i ] = ( ndot > 1.0 ) ? 0.0
+            : ( ndot < -1.0 ) ? M_PI : acos( ndot );
+        }
+
+      OutputVectorStatistic stats(storeSamples);
+      stats.addValues( errors.begin(), errors.end() );
+      stats.terminate();
+      computeNorms( errors, norms );
+      return stats;
+    }
+
+    /**
+     * Same as compare(aFirstEstimator,aSecondEstimator,itb,ite,storeSamples),
+     * but with the range eval() method of the estimators.
+     * @see evalRanges compareValues
+     *
+     * @param aFirstEstimator the first estimator.
+     * @param aSecondEstimator the second estimator.
+     * @param itb starting point of the comparison.
+     * @param ite ending point of the comparison.
+     * @param norms (returns) the norms of the errors.
+     * @param storeSamples if true, the instance of Statistic will
+     * store all the values.
+     * @param inParallel if true, the two estimators may be evaluated
+     * concurrently.
+     * @return the statistic of differences between the two estimator values
+     */
+    static
+    OutputStatistic
+    compareRange(FirstEstimator & aFirstEstimator,
+                 SecondEstimator & aSecondEstimator,
+                 const ConstIterator & itb,
+                 const ConstIterator & ite,
+                 ErrorNorms & norms,
+                 const bool storeSamples = false,
+                 const bool inParallel = false)
+    {
+      std::vector<Quantity> firstValues, secondValues;
+      evalRanges( aFirstEstimator, aSecondEstimator, itb, ite,
+                  firstValues, secondValues, inParallel );
+      return compareValues( firstValues, secondValues, norms, storeSamples );
+    }
+
+    /**
+     * Same as compareVectors(aFirstEstimator,aSecondEstimator,itb,ite,storeSamples),
+     * but with the range eval() method of the estimators.
+     * @see evalRanges compareVectorValues
+     *
+     * @param aFirstEstimator the first estimator.
+     * @param aSecondEstimator the second estimator.
+     * @param itb starting point of the comparison.
+     * @param ite ending point of the comparison.
+     * @param norms (returns) the norms of the angular errors.
+     * @param storeSamples if true, the instance of Statistic will
+     * store all the values.
+     * @param inParallel if true, the two estimators may be evaluated
+     * concurrently.
+     * @return the statistic of angular errors between the two estimator values
+     */
+    static
+    OutputVectorStatistic
+    compareVectorsRange(FirstEstimator & aFirstEstimator,
+                        SecondEstimator & aSecondEstimator,
+                        const ConstIterator & itb,
+                        const ConstIterator & ite,
+                        ErrorNorms & norms,
+                        const bool storeSamples = false,
+                        const bool inParallel = false)
+    {
+      std::vector<Quantity> firstValues, secondValues;
+      evalRanges( aFirstEstimator, aSecondEstimator, itb, ite,
+                  firstValues, secondValues, inParallel );
+      return compareVectorValues( firstValues, secondValues, norms, storeSamples );
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the norms of the sequence of errors @a errors in a
+     * single loop over a contiguous buffer.
+     */
+    template <typename Value>
+    static
+    void
+    computeNorms(const std::vector<Value> & errors, ErrorNorms & norms)
+    {
+      const unsigned int n = errors.size();
+      double l1 = 0.0, l2 = 0.0, linf = 0.0;
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          double e = std::fabs( (double) errors[ i ] );
+          l1 += e;
+          l2 += e * e;
+          linf = ( e > linf ) ? e : linf;
+        }
+      norms.samples = n;
+      norms.l1 = ( n > 0 ) ? l1 / n : 0.0;
+      norms.l2 = ( n > 0 ) ? std::sqrt( l2 / n ) : 0.0;
+      norms.linf = linf;
+    }
+
     // ------------------------- Hidden services ------------------------------
   private:
     
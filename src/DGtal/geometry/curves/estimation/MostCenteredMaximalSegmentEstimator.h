@@ -42,9 +42,12 @@
 // Inclusions
 #include <iostream>
 #include <list>
+#include <vector>
 
+#include "DGtal/base/Circulator.h"
 #include "DGtal/geometry/curves/estimation/SegmentComputerFunctor.h"
 #include "DGtal/geometry/curves/representation/MaximalSegments.h"
+#include "DGtal/geometry/curves/representation/SegmentComputerUtils.h"
 
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/base/Common.h"
@@ -59,6 +62,20 @@ namespace DGtal
    * Description of template class 'MostCenteredMaximalSegmentEstimator' <p>
    * \brief Aim:Computes a quantity to each element of a range associated to 
    * the most centered maximal segment  
+   *
+   * The quantities may be computed once for all the elements
+   * of the range with buildIndex(). Then, eval() only reads the
+   * stored quantities, in O(1) per element for random-access
+   * iterators, and update() recomputes them in the neighbourhood
+   * of a sub-range whose elements have been modified in place.
+   *
+   * @code
+   * Estimator e(sc,f); 
+   * e.init(1,r.begin(),r.end(),isClosed);
+   * e.buildIndex(); //O(n)
+   * for (ConstIterator i = r.begin(); i != r.end(); ++i) 
+   *   cout << e.eval(i) << " "; //O(1)
+   * @endcode
    */
   template <typename SegmentComputer, typename Functor>
   class MostCenteredMaximalSegmentEstimator
@@ -111,19 +128,53 @@ namespace DGtal
 
     /**
      * @return the estimated quantity at *it
-     * NB: O(n)
+     * NB: O(n), but O(1) for random-access iterators
+     * once buildIndex() has been called
      */
     Quantity eval(const ConstIterator& it);
 
     /**
      * @return the estimated quantity
      * from itb till ite (exculded)
-     * NB: O(n)
+     * NB: O(n), but in O(k) for the k elements of [itb,ite)
+     * and random-access iterators once buildIndex() has been called
      */
     template <typename OutputIterator>
     OutputIterator eval(const ConstIterator& itb, const ConstIterator& ite, 
                         OutputIterator result); 
 
+    /**
+     * Computes and stores the quantity of each element
+     * of the range so that eval() only reads them.
+     * NB: O(n)
+     */
+    void buildIndex();
+
+    /**
+     * @return 'true' if the quantities are stored
+     * (see buildIndex()), 'false' otherwise.
+     */
+    bool isIndexed() const;
+
+    /**
+     * Updates the stored quantities after that the elements of
+     * [itb,ite) have been modified in place (without any
+     * insertion or deletion in the range).
+     *
+     * The maximal segments are recomputed from the last maximal
+     * segments that do not touch [itb,ite), so that only the
+     * quantities of the elements whose most centered maximal segment
+     * may have changed are computed again. When the range is processed
+     * as closed and these maximal segments cross the first or the last
+     * element of the range, the whole index is built again.
+     *
+     * @param itb, begin iterator of the modified elements
+     * @param ite, end iterator of the modified elements
+     *
+     * NB: buildIndex() must have been called before.
+     */
+    void update(const ConstIterator& itb, const ConstIterator& ite);
+
 
     /**
      * Checks the validity/consistency of the object.
@@ -151,6 +202,10 @@ namespace DGtal
     ConstIterator myBegin,myEnd;
     /** range of maximal segments */ 
     deprecated::MaximalSegments<SegmentComputer> myMSRange; 
+    /** 'true' if the quantities are stored, 'false' otherwise */
+    bool myFlagIsIndexed;
+    /** quantities of the elements of the range, in the range order */
+    std::vector<Quantity> myQuantities;
 
     // ------------------------- Internal services ------------------------------
 
@@ -168,6 +223,34 @@ namespace DGtal
      */
     ConstIterator nextStepEndInLoop(const SegmentIterator& it1, const SegmentIterator& it2);
 
+    /**
+     * @return the position of [it] from myBegin
+     * NB: O(1) for random-access iterators, O(n) otherwise
+     */
+    std::size_t position(const ConstIterator& it) const;
+    std::size_t position(const ConstIterator& it, RandomAccessCategory) const;
+    template <typename Category>
+    std::size_t position(const ConstIterator& it, Category) const;
+
+    /**
+     * @return 'true' if [it] lies in [itb,ite], 'false' otherwise
+     */
+    static bool isBetween(const ConstIterator& it, 
+                          const ConstIterator& itb, const ConstIterator& ite);
+
+    /**
+     * Computes again, with the open cover of maximal segments,
+     * the quantities of the elements from the most centered
+     * maximal segment that follows the one whose back is [startBack]
+     * (or from [startBack] if [isFirst] is 'true'), until the
+     * second maximal segment whose back lies after [ite]. 
+     * @return 'false' if the range is processed as closed
+     * and these maximal segments cross its last element, 
+     * 'true' otherwise.
+     */
+    bool updateFrom(const ConstIterator& startBack, const bool& isFirst, 
+                    const ConstIterator& ite);
+
 
     // ------------------------- Hidden services ------------------------------
 
@@ -0,0 +1,303 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MultiScaleBinomialConvolver.h
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/27
+ *
+ * Header file for module MultiScaleBinomialConvolver.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see BinomialConvolver.h testBinomialConvolver.cpp
+ */
+
+#if defined(MultiScaleBinomialConvolver_RECURSES)
+#error Recursive header files inclusion detected in MultiScaleBinomialConvolver.h
+#else // defined(MultiScaleBinomialConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MultiScaleBinomialConvolver_RECURSES
+
+#if !defined MultiScaleBinomialConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define MultiScaleBinomialConvolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <map>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MultiScaleBinomialConvolver
+  /**
+     Description of template class 'MultiScaleBinomialConvolver'. <p>
+
+     @brief Aim: This class represents a 2D contour convolved by
+     binomials of several sizes. For each size n, it computes the same
+     convolved contour and first and second order derivatives as a
+     BinomialConvolver of size n, so as to estimate tangent and
+     curvature at several scales.
+
+     The binomial kernel of size n is the n-th power of the kernel
+     G2 = (1 2 1)/4 (see Signal::G2n). Instead of convolving the
+     contour with each kernel, the contour is convolved once by G2
+     for each size up to the greatest one, and the result is kept
+     for each requested size. Computing all the scales thus costs
+     O(n_max N) instead of O((n_1 + ... + n_k) N) for a contour of N
+     points. The convolutions by G2 are done in plain loops on
+     arrays, without the periodicity test of Signal, which the
+     compiler may vectorize.
+
+     When DGtal is built with OpenMP (WITH_OPENMP), the derivatives
+     of the different scales are computed in parallel.
+
+     @code
+     std::vector<unsigned int> sizes;
+     for ( unsigned int n = 1; n <= 64; n *= 2 ) sizes.push_back( n );
+     MultiScaleBinomialConvolver<ConstIterator> msbc;
+     msbc.init( h, itb, ite, true, sizes );
+     double k = msbc.curvature( 3, msbc.index( it ) ); // n = 8
+     @endcode
+
+     @tparam TConstIteratorOnPoints the type that represents an
+     iterator in a sequence of points. Each component of Point must be
+     convertible into a double.
+
+     @tparam TValue the type for storing the convolved versions of the
+     contour (double as default).
+
+     @see BinomialConvolver
+  */
+  template <typename TConstIteratorOnPoints, typename TValue = double>
+  class MultiScaleBinomialConvolver
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TValue Value;
+    typedef TConstIteratorOnPoints ConstIteratorOnPoints;
+    typedef typename ConstIteratorOnPoints::value_type Point;
+
+    /**
+       Constructor. The object is not valid.
+       @see init
+     */
+    MultiScaleBinomialConvolver();
+
+    /**
+     * Destructor.
+     */
+    ~MultiScaleBinomialConvolver();
+
+    /**
+       Initializes the convolver with some sequence of points.
+       @param h grid size (must be >0).
+       @param itb, begin iterator
+       @param ite, end iterator
+       @param isClosed true if the input range is viewed as closed.
+       @param sizes the parameters n of the sizes of the binomial
+       kernels (which are then 2^n), in any order. As for Signal::G2n,
+       0 is the same as 1.
+
+       The object is then valid.
+    */
+    void init( const double h,
+         const ConstIteratorOnPoints& itb,
+         const ConstIteratorOnPoints& ite,
+         const bool isClosed,
+         const std::vector<unsigned int> & sizes );
+
+    /**
+       @return the number of scales.
+    */
+    unsigned int nbScales() const;
+
+    /**
+       @param s any scale index.
+       @return the parameter for the size of the binomial kernel of
+       scale @a s.
+    */
+    unsigned int size( unsigned int s ) const;
+
+    /**
+       Given a valid iterator [it], return the corresponding index
+       position in the convolver in logarithmic time. The
+       method init should have been called before.
+
+       @param it any valid iterator
+       @return its index for accessing geometric data.
+    */
+    int index( const ConstIteratorOnPoints& it ) const;
+
+    /**
+     * @param s any scale index.
+     * @param i any index (0 is the first point).
+     *
+     * @return the position vector (x[ i ],y[ i ]) at scale @a s.
+     */
+    std::pair<Value,Value> x( unsigned int s, int i ) const;
+
+    /**
+     * @param s any scale index.
+     * @param i any index (0 is the first point).
+     *
+     * @return the derivative of the position (x'[ i ],y'[ i ]) at
+     * scale @a s.
+     */
+    std::pair<Value,Value> dx( unsigned int s, int i ) const;
+
+    /**
+     * @param s any scale index.
+     * @param i any index (0 is the first point).
+     *
+     * @return the second derivative of the position (x''[ i ],y''[ i
+     * ]) at scale @a s.
+     */
+    std::pair<Value,Value> d2x( unsigned int s, int i ) const;
+
+    /**
+     * @param s any scale index.
+     * @param i any index (0 is the first point).
+     *
+     * @return the normalized tangent vector at scale @a s.
+     */
+    std::pair<Value,Value> tangent( unsigned int s, int i ) const;
+
+    /**
+     * @param s any scale index.
+     * @param i any index (0 is the first point).
+     *
+     * @return the curvature of the signal at scale @a s.
+
+     * NB: depends on the gridstep.
+     */
+    Value curvature( unsigned int s, int i ) const;
+
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    double myH;
+    bool myIsClosed;
+    unsigned int myNbPoints;
+    std::vector<unsigned int> mySizes;
+    std::vector< std::vector<Value> > myX;
+    std::vector< std::vector<Value> > myY;
+    std::vector< std::vector<Value> > myDX;
+    std::vector< std::vector<Value> > myDY;
+    std::vector< std::vector<Value> > myDDX;
+    std::vector< std::vector<Value> > myDDY;
+
+    // Stores the mapping Iterator => Index.
+    std::map<ConstIteratorOnPoints,int> myMapIt2Idx;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    MultiScaleBinomialConvolver ( const MultiScaleBinomialConvolver & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    MultiScaleBinomialConvolver & operator= ( const MultiScaleBinomialConvolver & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Convolves @a in by G2 and writes the result in @a out, which
+       has the same size. If @a isClosed is false, the values of @a
+       in are 0 outside of its bounds.
+    */
+    static void convolveG2( const std::vector<Value> & in,
+          std::vector<Value> & out,
+          const bool isClosed );
+
+    /**
+       Computes the position and its derivatives of the scale @a s
+       from the convolved coordinates @a u, whose first point is at
+       index @a pad.
+    */
+    static void derivate( const std::vector<Value> & u, unsigned int pad,
+        unsigned int nbPoints, const bool isClosed,
+        std::vector<Value> & x,
+        std::vector<Value> & dx,
+        std::vector<Value> & ddx );
+
+    /**
+       @return the index in the arrays of a scale of the index @a i.
+    */
+    unsigned int arrayIndex( int i ) const;
+
+  }; // end of class MultiScaleBinomialConvolver
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MultiScaleBinomialConvolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MultiScaleBinomialConvolver' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TConstIteratorOnPoints, typename TValue >
+  std::ostream&
+  operator<< ( std::ostream & out,
+         const MultiScaleBinomialConvolver<TConstIteratorOnPoints,TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/evolution/MultiScaleBinomialConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MultiScaleBinomialConvolver_h
+
+#undef MultiScaleBinomialConvolver_RECURSES
+#endif // else defined(MultiScaleBinomialConvolver_RECURSES)
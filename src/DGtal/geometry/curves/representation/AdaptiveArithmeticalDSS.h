@@ -0,0 +1,399 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file AdaptiveArithmeticalDSS.h
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/25
+ *
+ * @brief Header file for module AdaptiveArithmeticalDSS.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see ArithmeticalDSS.h testArithmeticDSS-benchmark.cpp
+ */
+
+#if defined(AdaptiveArithmeticalDSS_RECURSES)
+#error Recursive header files inclusion detected in AdaptiveArithmeticalDSS.h
+#else // defined(AdaptiveArithmeticalDSS_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define AdaptiveArithmeticalDSS_RECURSES
+
+#if !defined AdaptiveArithmeticalDSS_h
+/** Prevents repeated inclusion of headers. */
+#define AdaptiveArithmeticalDSS_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/geometry/curves/representation/ArithmeticalDSS.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class AdaptiveArithmeticalDSS
+  /**
+   * Description of template class 'AdaptiveArithmeticalDSS' <p>
+   * \brief Aim: Dynamic recognition of a digital straight segment
+   * like ArithmeticalDSS, whose parameters are exactly computed with
+   * integers of type TInteger (typically BigInteger), but which does
+   * all its computations with machine integers (DGtal::int64_t)
+   * as long as they cannot overflow.
+   *
+   * The parameters a and b of a DSS are differences of coordinates of
+   * its points, and its remainders, intercept and thickness are
+   * computed from a and b and from these coordinates. If the absolute
+   * values of the coordinates are not greater than @a safeBound
+   * (2^30), all these values are thus bounded by 2^63 and are computed
+   * with an ArithmeticalDSS on DGtal::int64_t.
+   *
+   * As soon as a point beyond this bound is added to the segment, the
+   * points of the segment are recognized again by an ArithmeticalDSS
+   * on TInteger, which is used until the next call to init(). Only the
+   * rare segments that need it are thus recognized with TInteger.
+   *
+   * The coordinates of the points must be machine integers, so that
+   * they can be compared with @a safeBound. The parameters of the
+   * segment are returned as TInteger in both modes.
+   *
+   * @code
+   * typedef AdaptiveArithmeticalDSS<ConstIterator, BigInteger, 4> DSS;
+   * DSS dss( it );
+   * while ( ( dss.end() != itEnd ) && ( dss.extendForward() ) ) {}
+   * BigInteger a = dss.getA();
+   * bool exact = dss.isExact(); //'true' if BigInteger was used
+   * @endcode
+   *
+   * @tparam TIterator  type ConstIterator on 2D points with
+   * machine integer coordinates
+   * @tparam TInteger  type of the exact parameters (satisfying CInteger)
+   * @tparam connectivity  4 for standard DSS or 8 for naive DSS
+   *
+   * @see ArithmeticalDSS
+   */
+  template <typename TIterator,
+            typename TInteger,
+            int connectivity = 8>
+  class AdaptiveArithmeticalDSS
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( CInteger<TInteger> ));
+    typedef TInteger Integer;
+
+    typedef TIterator ConstIterator;
+    typedef AdaptiveArithmeticalDSS<ConstIterator,TInteger,connectivity> Self;
+    typedef AdaptiveArithmeticalDSS<std::reverse_iterator<ConstIterator>,TInteger,connectivity> Reverse;
+
+    /// segment computer used while the computations cannot overflow
+    typedef ArithmeticalDSS<ConstIterator,DGtal::int64_t,connectivity> FastDSS;
+    /// segment computer used otherwise
+    typedef ArithmeticalDSS<ConstIterator,TInteger,connectivity> ExactDSS;
+
+    typedef typename FastDSS::Point Point;
+    typedef typename FastDSS::Vector Vector;
+    typedef typename Point::Coordinate Coordinate;
+
+    /// greatest absolute value of the coordinates of the points
+    /// of a segment recognized with machine integers
+    static const DGtal::int64_t safeBound = ( (DGtal::int64_t) 1 ) << 30;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor.
+     * not valid
+     */
+    AdaptiveArithmeticalDSS();
+
+    /**
+     * Constructor with initialisation
+     * @param it an iterator on 2D points
+     * @see init
+     */
+    AdaptiveArithmeticalDSS( const ConstIterator & it );
+
+    /**
+     * Initialisation, in the fast mode
+     * if the point pointed to by @a it is not too far.
+     * @param it an iterator on 2D points
+     */
+    void init( const ConstIterator & it );
+
+    /**
+     * Copy constructor.
+     * The exact segment computer, if any, is shared until modified.
+     * @param other the object to clone.
+     */
+    AdaptiveArithmeticalDSS( const AdaptiveArithmeticalDSS & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    AdaptiveArithmeticalDSS & operator=( const AdaptiveArithmeticalDSS & other );
+
+    /**
+     * @return a default-constructed instance of Self.
+     */
+    Self getSelf() const;
+
+    /**
+     * @return a default-constructed instance of Reverse.
+     */
+    Reverse getReverse() const;
+
+    /**
+     * Equality operator.
+     * @param other the object to compare with.
+     * @return 'true' if both segments have the same points
+     * and the same parameters, whatever their modes.
+     */
+    bool operator==( const AdaptiveArithmeticalDSS & other ) const;
+
+    /**
+     * Difference operator.
+     * @param other the object to compare with.
+     * @return 'true' if not equal, 'false' otherwise.
+     */
+    bool operator!=( const AdaptiveArithmeticalDSS & other ) const;
+
+    /**
+     * Destructor.
+     */
+    ~AdaptiveArithmeticalDSS();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Tests whether the union between a point
+     * (pointing to by end()) and the DSS is a DSS.
+     * @return 'true' if the union is a DSS, 'false' otherwise.
+     */
+    bool isExtendableForward();
+
+    /**
+     * Tests whether the union between a point
+     * (located before begin()) and the DSS is a DSS.
+     * @return 'true' if the union is a DSS, 'false' otherwise.
+     */
+    bool isExtendableBackward();
+
+    /**
+     * Tests whether the union between a point
+     * (pointing to by end()) and the DSS is a DSS,
+     * and adds it to the DSS if it is.
+     * @return 'true' if the union is a DSS, 'false' otherwise.
+     */
+    bool extendForward();
+
+    /**
+     * Tests whether the union between a point
+     * (located before begin()) and the DSS is a DSS,
+     * and adds it to the DSS if it is.
+     * @return 'true' if the union is a DSS, 'false' otherwise.
+     */
+    bool extendBackward();
+
+    /**
+     * Removes the first point of the DSS (at the back).
+     * The exact mode, if set, is kept.
+     * @return 'true' if the DSS has at least two points, 'false' otherwise.
+     */
+    bool retractForward();
+
+    /**
+     * Removes the last point of the DSS (at the front).
+     * The exact mode, if set, is kept.
+     * @return 'true' if the DSS has at least two points, 'false' otherwise.
+     */
+    bool retractBackward();
+
+    /**
+     * @return 'true' if the parameters are computed with
+     * TInteger, 'false' if they are computed with machine integers.
+     */
+    bool isExact() const;
+
+    // ------------------------- Accessors ------------------------------
+
+    /**
+     * @return the y-component of the direction vector.
+     */
+    Integer getA() const;
+
+    /**
+     * @return the x-component of the direction vector.
+     */
+    Integer getB() const;
+
+    /**
+     * @return the intercept.
+     */
+    Integer getMu() const;
+
+    /**
+     * @return the thickness.
+     */
+    Integer getOmega() const;
+
+    /**
+     * @return first upper leaning point.
+     */
+    Point getUf() const;
+
+    /**
+     * @return last upper leaning point.
+     */
+    Point getUl() const;
+
+    /**
+     * @return first lower leaning point.
+     */
+    Point getLf() const;
+
+    /**
+     * @return last lower leaning point.
+     */
+    Point getLl() const;
+
+    /**
+     * @return the first point of the DSS.
+     */
+    Point getBackPoint() const;
+
+    /**
+     * @return the last point of the DSS.
+     */
+    Point getFrontPoint() const;
+
+    /**
+     * @return begin iterator of the DSS range.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return end iterator of the DSS range.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @param aPoint any point.
+     * @return the remainder of @a aPoint, a*x - b*y.
+     */
+    Integer getRemainder( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint any point.
+     * @return 'true' if @a aPoint is in the DSL, 'false' otherwise.
+     */
+    bool isInDSL( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint any point.
+     * @return 'true' if @a aPoint is in the DSS, 'false' otherwise.
+     */
+    bool isInDSS( const Point & aPoint ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// segment computer of the fast mode
+    FastDSS myFast;
+    /// segment computer of the exact mode (null in the fast mode)
+    CowPtr<ExactDSS> myExact;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint any point.
+     * @return 'true' if the coordinates of @a aPoint are
+     * not greater than @a safeBound in absolute value.
+     */
+    static bool isSafe( const Point & aPoint );
+
+    /**
+     * @param x any machine integer
+     * @return @a x as an Integer
+     */
+    static Integer toInteger( DGtal::int64_t x );
+
+    /**
+     * Recognizes the points of the fast segment computer
+     * with the exact one, which is then used.
+     */
+    void setExact();
+
+  }; // end of class AdaptiveArithmeticalDSS
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'AdaptiveArithmeticalDSS'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'AdaptiveArithmeticalDSS' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TIterator, typename TInteger, int connectivity>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const AdaptiveArithmeticalDSS<TIterator,TInteger,connectivity> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/representation/AdaptiveArithmeticalDSS.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined AdaptiveArithmeticalDSS_h
+
+#undef AdaptiveArithmeticalDSS_RECURSES
+#endif // else defined(AdaptiveArithmeticalDSS_RECURSES)
@@ -213,6 +213,21 @@ namespace DGtal
      */
     void getParameters(Vector3d& direction, PointD3d& intercept, PointD3d& thickness) const;
 
+    /**
+     * Computes the parameters 
+     * (direction, intercept, thickness)
+     * of a 3d DSS from the 2d DSS of its projections
+     * @param xy, xz, yz 2d DSS of the projections on the
+     * xy-, xz- and yz-planes
+     * @param direction
+     * @param intercept
+     * @param thickness
+     * @tparam DSS2d any ArithmeticalDSS on TInteger
+     */
+    template <typename DSS2d>
+    static void computeParameters(const DSS2d& xy, const DSS2d& xz, const DSS2d& yz,
+                                  Vector3d& direction, PointD3d& intercept, PointD3d& thickness);
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
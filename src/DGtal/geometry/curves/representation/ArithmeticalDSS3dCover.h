@@ -0,0 +1,221 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ArithmeticalDSS3dCover.h
+ * @author Tristan Roussillon (\c
+ * tristan.roussillon@liris.cnrs.fr ) Laboratoire d'InfoRmatique en
+ * Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS,
+ * France
+ *
+ * @date 2012/06/28
+ *
+ * Header file for module ArithmeticalDSS3dCover.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testArithDSS3d.cpp testArithDSS3d-benchmark.cpp
+ */
+
+#if defined(ArithmeticalDSS3dCover_RECURSES)
+#error Recursive header files inclusion detected in ArithmeticalDSS3dCover.h
+#else // defined(ArithmeticalDSS3dCover_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ArithmeticalDSS3dCover_RECURSES
+
+#if !defined ArithmeticalDSS3dCover_h
+/** Prevents repeated inclusion of headers. */
+#define ArithmeticalDSS3dCover_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/representation/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/representation/ArithmeticalDSS3d.h"
+//////////////////////////////////////////////////////////////////////////////
+
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ArithmeticalDSS3dCover
+  /**
+   * Description of class 'ArithmeticalDSS3dCover' <p>
+   * \brief Aim: computes all the maximal 3d DSS of an open 3d digital
+   * curve (its saturated cover), as the maximal segments of a
+   * SaturatedSegmentation of ArithmeticalDSS3d would be.
+   *
+   * As in ArithmeticalDSS3d, a 3d DSS is a sequence of points whose
+   * projections on the xy-, xz- and yz-planes are 2d DSS. The
+   * projections of the whole curve are computed once, the consecutive
+   * repeated points of each projection being removed. A window of 3d
+   * points then slides along the curve: one ArithmeticalDSS per
+   * projection is extended at the front and retracted at the back
+   * (with retractForward()), and only when the projection of the
+   * added or removed point differs from its neighbour. Each point is
+   * thus added and removed once, whereas a SaturatedSegmentation of
+   * ArithmeticalDSS3d, which cannot be retracted, recognizes each
+   * maximal segment again from scratch.
+   *
+   * @code
+   * typedef std::vector<Point>::const_iterator ConstIterator;
+   * ArithmeticalDSS3dCover<ConstIterator,int,4> cover( v.begin(), v.end() );
+   * for ( ArithmeticalDSS3dCover<ConstIterator,int,4>::ConstIterator
+   *         it = cover.begin(), itEnd = cover.end(); it != itEnd; ++it )
+   *   std::cout << *it->begin << " " << it->direction << std::endl;
+   * @endcode
+   *
+   * @tparam TIterator type ConstIterator on 3d points
+   * @tparam TInteger type of the parameters of the 2d DSS
+   * @tparam connectivity 8 or 4 for the 2d DSS of the projections
+   * (26- or 6-connected 3d curves)
+   */
+  template <typename TIterator, typename TInteger, int connectivity = 8>
+  class ArithmeticalDSS3dCover
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TInteger Integer;
+    typedef TIterator PointIterator;
+    typedef ArithmeticalDSS3d<PointIterator,TInteger,connectivity> DSS3d;
+    typedef typename DSS3d::Point3d Point3d;
+    typedef typename DSS3d::Vector3d Vector3d;
+    typedef typename DSS3d::Point2d Point2d;
+    typedef typename DSS3d::PointD3d PointD3d;
+
+    /// projection of the curve without consecutive repeated points
+    typedef std::vector<Point2d> Projection;
+    /// 2d DSS of a projection
+    typedef ArithmeticalDSS<typename Projection::const_iterator,TInteger,connectivity> DSS2d;
+
+    /**
+     * A maximal 3d DSS: its range and its parameters,
+     * as given by ArithmeticalDSS3d::getParameters().
+     */
+    struct Segment
+    {
+      /// first point
+      PointIterator begin;
+      /// after the last point
+      PointIterator end;
+      Vector3d direction;
+      PointD3d intercept;
+      PointD3d thickness;
+    };
+
+    typedef typename std::vector<Segment>::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor, with no segment.
+     */
+    ArithmeticalDSS3dCover();
+
+    /**
+     * Constructor.
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @see init
+     */
+    ArithmeticalDSS3dCover( const PointIterator& itb, const PointIterator& ite );
+
+    /**
+     * Computes the maximal 3d DSS of the open curve [itb,ite).
+     * Complexity: linear in the number of points.
+     * @param itb begin iterator
+     * @param ite end iterator
+     */
+    void init( const PointIterator& itb, const PointIterator& ite );
+
+    /**
+     * @return the number of maximal segments.
+     */
+    unsigned int size() const;
+
+    /**
+     * @return an iterator on the first maximal segment.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator after the last maximal segment.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// maximal segments, ordered along the curve
+    std::vector<Segment> mySegments;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @return 'true' if the point of index @a j, which follows the
+     * last point of index @a e, may be added to @a dss, 'false' otherwise.
+     */
+    static bool isExtendable( DSS2d* dss, const std::vector<unsigned int>* idx,
+                              unsigned int e, unsigned int j );
+
+  }; // end of class ArithmeticalDSS3dCover
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ArithmeticalDSS3dCover'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ArithmeticalDSS3dCover' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TIterator, typename TInteger, int connectivity>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ArithmeticalDSS3dCover<TIterator,TInteger,connectivity> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions/methods.
+#include "DGtal/geometry/curves/representation/ArithmeticalDSS3dCover.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ArithmeticalDSS3dCover_h
+
+#undef ArithmeticalDSS3dCover_RECURSES
+#endif // else defined(ArithmeticalDSS3dCover_RECURSES)
@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include <list>
+#include <vector>
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/geometry/curves/representation/ArithmeticalDSS.h"
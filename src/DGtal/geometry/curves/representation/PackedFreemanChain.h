@@ -0,0 +1,364 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/21
+ *
+ * @brief Header file for module PackedFreemanChain.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/representation/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: Describes, like FreemanChain, a digital 4-connected
+   * contour as a sequence of codes '0', '1', '2' and '3' and the
+   * coordinates of the first point, but stores four codes per byte.
+   *
+   * The packed codes are shared, with reference counting, by the
+   * chains that are built from them with subChain(), which thus
+   * does not copy any code. They are copied only when a chain that does not own
+   * them alone, or that is only a part of them, is extended.
+   *
+   * Together with the codes, the displacement from the first code to
+   * every @a checkpointStep -th code is stored, so that getPoint()
+   * only decodes, byte by byte thanks to a look-up table, the codes
+   * that follow the closest checkpoint.
+   *
+   * @code
+   * FreemanChain<int> fc( "0001112223330", 0, 0 );
+   * PackedFreemanChain<int> pc( fc );
+   * PackedFreemanChain<int>::Point p = pc.getPoint( 7 );
+   * PackedFreemanChain<int> sub = pc.subChain( 3, 6 ); //no copy
+   * std::vector<PackedFreemanChain<int>::Point> points;
+   * pc.getPoints( std::back_inserter( points ) ); //size()+1 points
+   * @endcode
+   *
+   * @tparam TInteger type of the coordinates of the points
+   *
+   * @see FreemanChain
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( CInteger<TInteger> ) );
+    typedef TInteger Integer;
+    typedef PackedFreemanChain<Integer> Self;
+    typedef FreemanChain<Integer> UnpackedChain;
+
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+
+    typedef unsigned int Size;
+    typedef unsigned int Index;
+
+    /// number of codes between two consecutive checkpoints
+    /// (a multiple of 4)
+    static const Size checkpointStep = 256;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param s the chain code.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( const std::string & s = "",
+                        Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a Freeman chain.
+     * @param aChain any Freeman chain.
+     */
+    explicit PackedFreemanChain( const UnpackedChain & aChain );
+
+    /**
+     * Constructor from the points of a 4-connected path, like the
+     * contours given by Surfaces::scanAllPointContours4C.
+     * The codes are packed directly, without any string.
+     * @param aPoints a sequence of 4-adjacent points (may be empty).
+     */
+    explicit PackedFreemanChain( const std::vector<Point> & aPoints );
+
+    /**
+     * Copy constructor.
+     * The codes are shared with @a other.
+     * @param other the object to clone.
+     */
+    PackedFreemanChain( const PackedFreemanChain & other );
+
+    /**
+     * Assignment.
+     * The codes are shared with @a other.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    PackedFreemanChain & operator=( const PackedFreemanChain & other );
+
+    /**
+     * Destructor.
+     */
+    ~PackedFreemanChain();
+
+    /**
+     * @param other the object to compare with.
+     * @return 'true' if both chains have the same first point
+     * and the same codes, 'false' otherwise.
+     */
+    bool operator==( const PackedFreemanChain & other ) const;
+
+    /**
+     * @param other the object to compare with.
+     * @return 'false' if both chains have the same first point
+     * and the same codes, 'true' otherwise.
+     */
+    bool operator!=( const PackedFreemanChain & other ) const
+    {
+      return !( *this == other );
+    }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param pos a position in the chain code.
+     * @return the code at position [pos] ('0', '1', '2' or '3').
+     */
+    char code( Index pos ) const;
+
+    /**
+     * @return the number of codes.
+     */
+    Size size() const;
+
+    /**
+     * @return the first point of the chain.
+     */
+    Point firstPoint() const;
+
+    /**
+     * @return the last point of the chain.
+     * NB: in O(checkpointStep)
+     */
+    Point lastPoint() const;
+
+    /**
+     * @return the vector from the first point to the last point.
+     * NB: in O(checkpointStep)
+     */
+    Vector totalDisplacement() const;
+
+    /**
+     * @param pos a position in [0, size()].
+     * @return the point at position [pos].
+     * NB: in O(checkpointStep)
+     */
+    Point getPoint( Index pos ) const;
+
+    /**
+     * Writes the size()+1 points of the chain, like
+     * FreemanChain::getContourPoints.
+     * @param result an output iterator on points.
+     * @return the output iterator after the last written point.
+     */
+    template <typename OutputIterator>
+    OutputIterator getPoints( OutputIterator result ) const;
+
+    /**
+     * @param pos the position of the first code.
+     * @param n the number of codes.
+     * @return the chain made of the codes of position pos to pos+n-1,
+     * which starts at getPoint(pos).
+     * NB: the codes are shared, O(checkpointStep).
+     */
+    PackedFreemanChain subChain( Index pos, Size n ) const;
+
+    /**
+     * @param other any chain.
+     * @return the concatenation of the codes of 'this' and of
+     * [other], starting at the first point of 'this'.
+     */
+    PackedFreemanChain operator+( const PackedFreemanChain & other ) const;
+
+    /**
+     * Appends the codes of [other] to the codes of 'this'.
+     * @param other any chain.
+     * @return a reference on 'this'.
+     * NB: the codes are appended in place, without any copy of
+     * the codes of 'this', if they are not shared.
+     */
+    PackedFreemanChain & operator+=( const PackedFreemanChain & other );
+
+    /**
+     * Appends a code.
+     * @param aCode a code ('0', '1', '2' or '3').
+     * @return a reference on 'this'.
+     */
+    PackedFreemanChain & extend( char aCode );
+
+    /**
+     * @return the codes as a string.
+     */
+    std::string chain() const;
+
+    /**
+     * @return the same chain as a Freeman chain.
+     */
+    UnpackedChain unpack() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Packed codes, shared by chains,
+     * and their checkpoints.
+     */
+    struct Storage
+    {
+      /// codes, the i-th one in bits 2(i%4) and 2(i%4)+1 of byte i/4
+      std::vector<unsigned char> bytes;
+      /// displacement of the first k.checkpointStep codes, for each k
+      std::vector<Vector> checkpoints;
+      /// number of codes
+      Size size;
+    };
+
+    /// codes (and checkpoints)
+    CountedPtr<Storage> myStorage;
+    /// position of the first code of the chain in the storage
+    Index myOffset;
+    /// number of codes of the chain
+    Size mySize;
+    /// first point
+    Point myFirstPoint;
+    /// displacement of the codes of the storage before the first code
+    Vector myOrigin;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aStorage any storage.
+     * @param pos a position in [0, aStorage.size].
+     * @return the displacement of the first [pos] codes of [aStorage].
+     */
+    static Vector displacement( const Storage & aStorage, Index pos );
+
+    /**
+     * Decodes the codes of [aStorage] from [first] to [last] (excluded).
+     * @return the displacement of these codes.
+     */
+    static Vector decode( const Storage & aStorage, Index first, Index last );
+
+    /**
+     * Appends [n] codes of [aSrc], from [pos], to [aDst]
+     * and updates its checkpoints.
+     */
+    static void append( Storage & aDst, const Storage & aSrc, Index pos, Size n );
+
+    /**
+     * Appends a code to [aDst] without updating its checkpoints.
+     */
+    static void push( Storage & aDst, unsigned char aCode );
+
+    /**
+     * Adds to [aStorage] the checkpoints of its last codes.
+     */
+    static void updateCheckpoints( Storage & aStorage );
+
+    /**
+     * Makes sure that 'this' owns its codes alone and that
+     * they end at the end of the storage, so that codes may be
+     * appended in place.
+     */
+    void makeAppendable();
+
+  }; // end of class PackedFreemanChain
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/representation/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
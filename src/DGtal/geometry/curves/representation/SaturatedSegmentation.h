@@ -440,6 +440,35 @@ namespace DGtal
      */
     typename SaturatedSegmentation::SegmentComputerIterator end() const;
 
+    /**
+     * Writes into @a out all the segments of the segmentation,
+     * in the order in which they are visited by a
+     * SegmentComputerIterator.
+     *
+     * The range of the first positions of the segments, from the
+     * first segment to the last one, is split into @a aNbChunks
+     * chunks. Each chunk starts at the last maximal segment passing
+     * through its first element (or at the following one) and ends
+     * at the start of the next chunk, so that the stitched output
+     * is exactly the one of the sequential iteration. The chunks are
+     * processed in parallel when DGtal is built with OpenMP
+     * (WITH_OPENMP).
+     *
+     * Nb: complexity in O(n), with n the length of the range.
+     * Splitting the range into chunks requires a linear walk
+     * through it if the iterators are not random access ones.
+     *
+     * @param out any output iterator on segment computers
+     * @param aNbChunks the number of chunks (if 0, the number of
+     * available threads).
+     * @return the output iterator after the last written segment.
+     *
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template <typename TOutputIterator>
+    TOutputIterator copySegments( TOutputIterator out,
+                                  unsigned int aNbChunks = 0 ) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -41,9 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
-#include <list>
+#include <deque>
 #include "DGtal/base/Common.h"
-#include "DGtal/base/OpInSTLContainers.h"
 #include "DGtal/shapes/fromPoints/Point2ShapePredicate.h"
 #include "DGtal/io/Color.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -77,6 +76,10 @@ namespace DGtal
    * will return the right output.
    *
    * @tparam Shape  a model of COrientableHypersurface
+   * @tparam TContainer  a container of points supporting push and pop
+   * at both ends, like std::deque (default) or std::list. The hulls are
+   * only modified at their ends, so that a deque avoids one allocation
+   * per vertex and keeps the vertices contiguous by blocks.
    *
    * You can define your preimage type from a given shape type as follows:
    * @snippet geometry/curves/tools/examplePreimage.cpp PreimageTypedefFromStraightLine
@@ -89,7 +92,8 @@ namespace DGtal
    *
    * @see examplePreimage.cpp testPreimage.cpp
    */
-  template <typename Shape>
+  template <typename Shape,
+            typename TContainer = std::deque<typename Shape::Point> >
   class Preimage2D
   {
 
@@ -100,15 +104,16 @@ namespace DGtal
     typedef typename Shape::Point Point;
     typedef typename Shape::Point Vector;
 
+    //container of points
+    typedef TContainer Container;
+
   private:
 
-    //container of points
-    typedef std::list<Point> Container;
     //Iterators on the container
-    typedef typename std::list<Point>::iterator ForwardIterator;
-    typedef typename std::list<Point>::reverse_iterator BackwardIterator;
-    typedef typename std::list<Point>::const_iterator ConstForwardIterator;
-    typedef typename std::list<Point>::const_reverse_iterator ConstBackwardIterator;
+    typedef typename Container::iterator ForwardIterator;
+    typedef typename Container::reverse_iterator BackwardIterator;
+    typedef typename Container::const_iterator ConstForwardIterator;
+    typedef typename Container::const_reverse_iterator ConstBackwardIterator;
 
     //Predicates used to decide whether the preimage
     //has to be updated or not
@@ -398,24 +403,38 @@ namespace DGtal
   private:
 
     /**
-     * Updates the current preimage
+     * Updates the current preimage by removing
+     * the vertices at the front of @a aContainer
+     * that do not satisfy @a Predicate any more
+     * because of the new vertex @a aPoint.
+     *
+     * Nb: in O(n)
+     *
+     * @param aPoint  a new vertex of the preimage,
+     * @param aContainer  the container to be updated
+     *
+     * @tparam Predicate  the type of Predicate
+     */
+    template <typename Predicate>
+    void updateFront(const Point & aPoint, 
+                     Container & aContainer);
+
+    /**
+     * Updates the current preimage by removing
+     * the vertices at the back of @a aContainer
+     * that do not satisfy @a Predicate any more
+     * because of the new vertex @a aPoint.
      *
      * Nb: in O(n)
      *
      * @param aPoint  a new vertex of the preimage,
-     * @param aContainer  the STL-like container to be updated,
-     * @param anIterator  an iterator to its front (resp. back)
-     * @param anEndIterator  an iterator pointing after its back 
-     * (resp. before its front). 
+     * @param aContainer  the container to be updated
      *
-     * @tparam Iterator  the type of Iterator (either Container::iterator or Container::reverse_iterator)
      * @tparam Predicate  the type of Predicate
      */
-    template <typename Iterator, typename Predicate>
-    void update(const Point & aPoint, 
-                Container & aContainer,
-                Iterator & anIterator,
-                const Iterator & anEndIterator);
+    template <typename Predicate>
+    void updateBack(const Point & aPoint, 
+                    Container & aContainer);
 
 
 
@@ -431,9 +450,9 @@ namespace DGtal
    * @param object the object of class 'Preimage2D' to write.
    * @return the output stream after the writing.
    */
-   template <typename Shape>
+  template <typename Shape, typename TContainer>
   std::ostream&
-  operator<< ( std::ostream & out, const Preimage2D<Shape> & object );
+  operator<< ( std::ostream & out, const Preimage2D<Shape, TContainer> & object );
 
 
 } // namespace DGtal
@@ -0,0 +1,293 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryConstImageAdapter.h
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/20
+ *
+ * Header file for module BinaryConstImageAdapter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BinaryConstImageAdapter_RECURSES)
+#error Recursive header files inclusion detected in BinaryConstImageAdapter.h
+#else // defined(BinaryConstImageAdapter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryConstImageAdapter_RECURSES
+
+#if !defined BinaryConstImageAdapter_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryConstImageAdapter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <boost/static_assert.hpp>
+#include <boost/type_traits.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+
+#include <iostream>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BinaryConstImageAdapter
+  /**
+   * Description of template class 'BinaryConstImageAdapter' <p>
+   * \brief Aim: implements a model of CConstImage
+   * that combines the values of two underlying images.
+   *
+   * @tparam TImage1 a model of CConstImage
+   * @tparam TImage2 a model of CConstImage,
+   * defined on the same domain type as TImage1
+   *
+   * The values associated to the points are computed
+   * with a binary functor f given at construction so that
+   * operator() calls f(img1(aPoint), img2(aPoint)).
+   *
+   * @tparam TFunctor the type of binary functor that combines
+   * the values of the two images
+   *
+   * @tparam TValue type of the value returned by the functor.
+   *
+   * Together with ConstImageAdapter, it is used to build
+   * lazy image expressions, like the thresholded difference
+   * of two images:
+   *
+   * @code
+   * typedef BinaryConstImageAdapter<Image, Image, MinusFunctor<int>, int> Difference;
+   * MinusFunctor<int> minus;
+   * Difference diff( img1, img2, minus );
+   * Thresholder<int> t( 10 );
+   * ConstImageAdapter<Difference, Thresholder<int>, bool> mask( diff, t );
+   * @endcode
+   *
+   * The whole expression may then be evaluated in a single
+   * fused pass with imageFromConstImage() (see ConstImageEvaluation.h).
+   *
+   * NB: the underlying images as well as the functor
+   * are stored in the adapter as aliasing pointer
+   * in order to avoid copies.
+   * The pointed objects must exist and must not be deleted
+   * during the use of the adapter
+   *
+   * @see ConstImageAdapter
+   */
+  template <typename TImage1, typename TImage2, typename TFunctor, typename TValue>
+  class BinaryConstImageAdapter
+  {
+    // ----------------------- Types definitions ------------------------------
+  public:
+
+    typedef BinaryConstImageAdapter<TImage1, TImage2, TFunctor, TValue> Self;
+    typedef TImage1 Image1;
+    BOOST_CONCEPT_ASSERT(( CConstImage<Image1> ));
+    typedef TImage2 Image2;
+    BOOST_CONCEPT_ASSERT(( CConstImage<Image2> ));
+    typedef TFunctor Functor;
+
+    typedef typename Image1::Domain Domain;
+    BOOST_CONCEPT_ASSERT(( CDomain<Domain> ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, typename Image2::Domain >::value ));
+
+    typedef TValue Value;
+    BOOST_CONCEPT_ASSERT(( CLabel<TValue> ));
+
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Dimension Dimension;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+
+    // static constants
+    static const Dimension dimension = Domain::dimension;
+
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /**
+     * Constructor.
+     * @param aImg1 any image
+     * @param aImg2 any image, whose domain contains the one of @a aImg1
+     * @param aF any binary functor
+     */
+    BinaryConstImageAdapter(const Image1 &aImg1, const Image2 &aImg2,
+                            const TFunctor &aF)
+      : myImg1(&aImg1), myImg2(&aImg2), myF(&aF) {}
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    BinaryConstImageAdapter ( const BinaryConstImageAdapter & other )
+      : myImg1(other.myImg1), myImg2(other.myImg2), myF(other.myF) {}
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    BinaryConstImageAdapter & operator= ( const BinaryConstImageAdapter & other )
+    {
+      if (this != &other)
+	{
+	  myImg1 = other.myImg1;
+	  myImg2 = other.myImg2;
+	  myF = other.myF;
+	}
+      return *this;
+    }
+
+    /**
+     * Destructor.
+     */
+    ~BinaryConstImageAdapter() {}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position.
+     *
+     * @param aPoint  position in the image.
+     * @return the value at aPoint.
+     */
+    Value operator()(const Point &aPoint) const
+    {
+      return myF->operator()( myImg1->operator()(aPoint),
+                              myImg2->operator()(aPoint) );
+    }
+
+    // ------------------------- methods ------------------------------
+
+    /**
+     * @return the domain associated to the image,
+     * ie. the domain of the first image.
+     */
+    const Domain& domain() const
+    {
+      return myImg1->domain();
+    }
+
+    /**
+     * @return the first underlying image.
+     */
+    const Image1& image1() const
+    {
+      return *myImg1;
+    }
+
+    /**
+     * @return the second underlying image.
+     */
+    const Image2& image2() const
+    {
+      return *myImg2;
+    }
+
+    /**
+     * @return the functor combining the values
+     * of the underlying images.
+     */
+    const TFunctor& functor() const
+    {
+      return *myF;
+    }
+
+    /**
+     * @return the range that can be used
+     * to iterate over the values of the image.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return true;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[BinaryConstImageAdapter] " << *myImg1 << " " << *myImg2;
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Aliasing pointer on the first underlying image
+     */
+    const Image1* myImg1;
+
+    /**
+     * Aliasing pointer on the second underlying image
+     */
+    const Image2* myImg2;
+
+    /**
+     * Aliasing pointer on the underlying functor
+     */
+    const TFunctor* myF;
+
+  }; // end of class BinaryConstImageAdapter
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BinaryConstImageAdapter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BinaryConstImageAdapter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage1, typename TImage2, typename TFunctor, typename TValue>
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const BinaryConstImageAdapter<TImage1, TImage2, TFunctor, TValue> & object )
+  {
+    object.selfDisplay( out );
+    return out;
+  }
+
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryConstImageAdapter_h
+
+#undef BinaryConstImageAdapter_RECURSES
+#endif // else defined(BinaryConstImageAdapter_RECURSES)
@@ -42,6 +42,7 @@
 // Inclusions
 #include "DGtal/base/Common.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/base/CountedPtr.h"
 #include "DGtal/base/ConstRangeFromPointAdapter.h"
 #include "DGtal/base/CLabel.h"
 #include "DGtal/base/CUnaryFunctor.h"
@@ -83,7 +84,12 @@ namespace DGtal
    * are stored in the adapter as aliasing pointer
    * in order to avoid copies.  
    * The pointed objects must exist and must not be deleted 
-   * during the use of the adapter
+   * during the use of the adapter. The range of the underlying 
+   * image values is shared by the copies of the adapter, so 
+   * that copying an adapter (or a chain of adapters) is cheap. 
+   *
+   * Chains of adapters may be evaluated in a single fused pass 
+   * with imageFromConstImage() (see ConstImageEvaluation.h). 
    *
    * @see exampleConstImageAdapter
    */
@@ -131,7 +137,7 @@ namespace DGtal
      * @param other the object to clone.
      */
     ConstImageAdapter ( const ConstImageAdapter & other )
-      : myImg(other.myImg), myF(other.myF), myR( new ImageRange(*other.myR) ) {}
+      : myImg(other.myImg), myF(other.myF), myR( other.myR ) {}
 
     /**
      * Assignment.
@@ -144,8 +150,7 @@ namespace DGtal
 	{
 	  myImg = other.myImg; 
 	  myF = other.myF;
-	  delete myR; 
-	  myR = new ImageRange( *other.myR ); 
+	  myR = other.myR; 
 	}
       return *this; 
     }
@@ -154,7 +159,7 @@ namespace DGtal
     /**
      * Destructor.
      */
-    ~ConstImageAdapter() { delete myR; }
+    ~ConstImageAdapter() {}
 
     // ----------------------- Interface --------------------------------------
   public:
@@ -182,6 +187,23 @@ namespace DGtal
       return myImg->domain();
     }
 
+    /**
+     * @return the underlying image.
+     */
+    const Image& image() const
+    {
+      return *myImg;
+    }
+
+    /**
+     * @return the functor applied to the values 
+     * of the underlying image.
+     */
+    const TFunctor& functor() const
+    {
+      return *myF;
+    }
+
     /**
      * @return the range that can be used 
      * to iterate over the values of the image.
@@ -233,12 +255,12 @@ namespace DGtal
     const TFunctor* myF; 
 
     /**
-     * Owning pointer on the range of the image values
+     * Shared pointer on the range of the image values
      * (stored to be able to use the range adapter, 
      * which is light and requires that the range 
      * to adapt exists during the life of the adapter)
      */
-    const ImageRange* myR; 
+    CountedPtr<ImageRange> myR; 
 
   }; // end of class ConstImageAdapter
 
@@ -0,0 +1,248 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConstImageEvaluation.h
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/20
+ *
+ * Header file for module ConstImageEvaluation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConstImageEvaluation_RECURSES)
+#error Recursive header files inclusion detected in ConstImageEvaluation.h
+#else // defined(ConstImageEvaluation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConstImageEvaluation_RECURSES
+
+#if !defined ConstImageEvaluation_h
+/** Prevents repeated inclusion of headers. */
+#define ConstImageEvaluation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/BinaryConstImageAdapter.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /**
+     * Evaluates an image expression (an image, or a tree of
+     * ConstImageAdapter and BinaryConstImageAdapter) at a point
+     * whose offset, in the order of a given domain, is known.
+     *
+     * The generic version calls the image accessor.
+     *
+     * @tparam TImage any model of CConstImage
+     */
+    template <typename TImage>
+    struct FusedEvaluator
+    {
+      typedef typename TImage::Value Value;
+      typedef typename TImage::Domain Domain;
+      typedef typename TImage::Point Point;
+
+      /**
+       * @return 'true' if value() may be called for the points
+       * of @a aDomain with their offset in @a aDomain.
+       */
+      static bool isAligned( const TImage & /*aImg*/, const Domain & /*aDomain*/ )
+      {
+        return true;
+      }
+
+      static Value value( const TImage & aImg, const Point & aPoint,
+                          std::size_t /*anOffset*/ )
+      {
+        return aImg( aPoint );
+      }
+    };
+
+    /**
+     * Specialization for ImageContainerBySTLVector: the value is
+     * directly read at the offset when the image is defined on the
+     * evaluation domain.
+     */
+    template <typename TDomain, typename TValue>
+    struct FusedEvaluator< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+      typedef TValue Value;
+      typedef TDomain Domain;
+      typedef typename TDomain::Point Point;
+
+      static bool isAligned( const Image & aImg, const Domain & aDomain )
+      {
+        return ( aImg.domain().lowerBound() == aDomain.lowerBound() )
+          && ( aImg.domain().upperBound() == aDomain.upperBound() );
+      }
+
+      static Value value( const Image & aImg, const Point & /*aPoint*/,
+                          std::size_t anOffset )
+      {
+        return aImg[ anOffset ];
+      }
+    };
+
+    /**
+     * Specialization for ConstImageAdapter: the functor is applied
+     * to the value of the underlying image expression.
+     */
+    template <typename TImage, typename TFunctor, typename TValue>
+    struct FusedEvaluator< ConstImageAdapter<TImage, TFunctor, TValue> >
+    {
+      typedef ConstImageAdapter<TImage, TFunctor, TValue> Image;
+      typedef TValue Value;
+      typedef typename Image::Domain Domain;
+      typedef typename Image::Point Point;
+
+      static bool isAligned( const Image & aImg, const Domain & aDomain )
+      {
+        return FusedEvaluator<TImage>::isAligned( aImg.image(), aDomain );
+      }
+
+      static Value value( const Image & aImg, const Point & aPoint,
+                          std::size_t anOffset )
+      {
+        return aImg.functor()
+          ( FusedEvaluator<TImage>::value( aImg.image(), aPoint, anOffset ) );
+      }
+    };
+
+    /**
+     * Specialization for BinaryConstImageAdapter: the functor is
+     * applied to the values of both underlying image expressions.
+     */
+    template <typename TImage1, typename TImage2, typename TFunctor, typename TValue>
+    struct FusedEvaluator< BinaryConstImageAdapter<TImage1, TImage2, TFunctor, TValue> >
+    {
+      typedef BinaryConstImageAdapter<TImage1, TImage2, TFunctor, TValue> Image;
+      typedef TValue Value;
+      typedef typename Image::Domain Domain;
+      typedef typename Image::Point Point;
+
+      static bool isAligned( const Image & aImg, const Domain & aDomain )
+      {
+        return FusedEvaluator<TImage1>::isAligned( aImg.image1(), aDomain )
+          && FusedEvaluator<TImage2>::isAligned( aImg.image2(), aDomain );
+      }
+
+      static Value value( const Image & aImg, const Point & aPoint,
+                          std::size_t anOffset )
+      {
+        return aImg.functor()
+          ( FusedEvaluator<TImage1>::value( aImg.image1(), aPoint, anOffset ),
+            FusedEvaluator<TImage2>::value( aImg.image2(), aPoint, anOffset ) );
+      }
+    };
+
+    /**
+     * Writes the values of an image expression into an image.
+     * The generic version sets the values point by point.
+     *
+     * @tparam TImage any model of CImage
+     * @tparam TConstImage any model of CConstImage
+     */
+    template <typename TImage, typename TConstImage>
+    struct ConstImageMaterializer
+    {
+      static void materialize( TImage & aImg, const TConstImage & aSrc,
+                               std::size_t aTileSize );
+    };
+
+    /**
+     * Specialization for ImageContainerBySTLVector: the spans of the
+     * first dimension are grouped into tiles, which are filled in
+     * parallel when DGtal is built with OpenMP (WITH_OPENMP).
+     */
+    template <typename TDomain, typename TValue, typename TConstImage>
+    struct ConstImageMaterializer< ImageContainerBySTLVector<TDomain, TValue>, TConstImage >
+    {
+      typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+      typedef typename TDomain::Point Point;
+
+      static void materialize( Image & aImg, const TConstImage & aSrc,
+                               std::size_t aTileSize );
+
+    private:
+      /**
+       * Fills the spans [@a aFirst, @a aLast) of @a aImg.
+       * @tparam isFused when 'true', the values are computed with
+       * FusedEvaluator, otherwise with the accessor of @a aSrc.
+       */
+      template <bool isFused>
+      static void fillSpans( Image & aImg, const TConstImage & aSrc,
+                             std::size_t aFirst, std::size_t aLast );
+    };
+  } // namespace detail
+
+  /**
+   * Writes into @a aImg the values of the image expression @a aSrc
+   * at each point of the domain of @a aImg, which must be included
+   * in the domain of @a aSrc.
+   *
+   * The expression is any image or any tree of ConstImageAdapter and
+   * BinaryConstImageAdapter: it is evaluated lazily, in a single pass,
+   * each value being computed by the composition of the functors of
+   * the tree, without any intermediate image. When @a aImg is an
+   * ImageContainerBySTLVector, its spans are grouped into tiles of
+   * about @a aTileSize points and the images of the expression
+   * that are ImageContainerBySTLVector defined on the same domain are
+   * read at the offset of the current point, without any call to
+   * linearized(). When DGtal is built with OpenMP (WITH_OPENMP), the
+   * tiles are processed in parallel: the functors and the accessors
+   * of the images of the expression must then be thread-safe.
+   *
+   * @param aImg (returned) image
+   * @param aSrc the image expression to evaluate
+   * @param aTileSize the number of points per tile
+   *
+   * @tparam TImage any model of CImage
+   * @tparam TConstImage any model of CConstImage
+   */
+  template <typename TImage, typename TConstImage>
+  void imageFromConstImage( TImage & aImg, const TConstImage & aSrc,
+                            std::size_t aTileSize = 1 << 16 );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ConstImageEvaluation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConstImageEvaluation_h
+
+#undef ConstImageEvaluation_RECURSES
+#endif // else defined(ConstImageEvaluation_RECURSES)
@@ -54,6 +54,7 @@
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
@@ -63,6 +64,80 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Scans the values of an image in the order of its domain. 
+     * The generic version goes through the points of the domain
+     * and the image accessors. 
+     *
+     * @tparam TImage any model of CConstImage
+     */
+    template <typename TImage>
+    struct ImageValueScanner
+    {
+      typedef typename TImage::Value Value; 
+      typedef typename TImage::Point Point; 
+
+      /**
+       * Writes into @a ito the points whose value 
+       * satisfies the value predicate @a aPred.
+       * @return the output iterator after the last written point.
+       */
+      template <typename O, typename P>
+      static O copyPointsIf(const TImage& aImg, O ito, const P& aPred); 
+
+      /**
+       * Sets @a aValue at each point of the domain of @a aImg.
+       */
+      static void fill(TImage& aImg, const Value& aValue); 
+
+      /**
+       * Sets at each point of the domain of @a aImg 
+       * the value returned by @a aFun.
+       */
+      template <typename F>
+      static void fromFunctor(TImage& aImg, const F& aFun); 
+
+      /**
+       * Copies the values of @a aImg2 into @a aImg1. 
+       */
+      static void copy(TImage& aImg1, const TImage& aImg2); 
+    }; 
+
+    /**
+     * Specialization for ImageContainerBySTLVector: the values are 
+     * stored in the order of the domain, so that the scans are 
+     * contiguous loops over the spans of the first dimension 
+     * (without any call to linearized()). The points are only 
+     * maintained, row by row, when they are required. 
+     */
+    template <typename TDomain, typename TValue>
+    struct ImageValueScanner< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      typedef ImageContainerBySTLVector<TDomain, TValue> Image; 
+      typedef TValue Value; 
+      typedef typename TDomain::Point Point; 
+
+      template <typename O, typename P>
+      static O copyPointsIf(const Image& aImg, O ito, const P& aPred); 
+
+      static void fill(Image& aImg, const Value& aValue); 
+
+      template <typename F>
+      static void fromFunctor(Image& aImg, const F& aFun); 
+
+      static void copy(Image& aImg1, const Image& aImg2); 
+
+    private: 
+      /**
+       * Moves @a aPoint to the first point of the next span
+       * (along the first dimension) of the domain [@a aLow, @a aUp].
+       */
+      static void nextSpan(Point& aPoint, const Point& aLow, const Point& aUp); 
+    }; 
+  } // namespace detail
+
   /// useful functions
   /**
    * Fill a set through the inserter @a ito
@@ -188,6 +263,18 @@ namespace DGtal
   template<typename I, typename F>
   void imageFromFunctor(I& aImg, const F& aFun); 
 
+  /**
+   * Set the values of @a aImg at @a aValue
+   * for each point of its domain.
+   *
+   * @param aImg (returned) image
+   * @param aValue any value
+   *
+   * @tparam I any model of CImage
+   */
+  template<typename I>
+  void fillImage(I& aImg, const typename I::Value& aValue); 
+
   /**
    * Copy the values of @a aImg2 into @a aImg1 .
    *
@@ -45,6 +45,8 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/images/imagesSetsUtils/IntervalForegroundPredicate.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -150,8 +152,16 @@ namespace DGtal
 		const typename Image::Value minVal,
 		const typename Image::Value maxVal)
     {
-      IntervalForegroundPredicate<Image> isForeground(aImage,minVal,maxVal);
-      append(aSet,aImage,isForeground);
+      //the values are directly scanned (contiguously for 
+      //ImageContainerBySTLVector), without any copy of the image
+      typedef Thresholder<typename Image::Value,false,false> T1; 
+      T1 t1( minVal ); 
+      typedef Thresholder<typename Image::Value,true,true> T2; 
+      T2 t2( maxVal ); 
+      AndBoolFct2 f; 
+      PredicateCombiner<T1,T2,AndBoolFct2> isForeground( t1, t2, f ); 
+      detail::ImageValueScanner<Image>::copyPointsIf
+        ( aImage, DigitalSetInserter<Set>( aSet ), isForeground ); 
     }
 
   };
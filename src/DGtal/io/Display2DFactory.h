@@ -240,8 +240,8 @@ template<Dimension dim, typename TComponent>
     
     
 // Preimage2D
-template <typename Shape>
-void draw( DGtal::Board2D & aBoard, const DGtal::Preimage2D<Shape> & );
+template <typename Shape, typename TContainer>
+void draw( DGtal::Board2D & aBoard, const DGtal::Preimage2D<Shape, TContainer> & );
 // Preimage2D
     
     
@@ -41,7 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 //////////////////////////////////////////////////////////////////////////////
 
 #ifdef _MSC_VER
@@ -51,6 +54,47 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Copies a row of decoded values into an image, along its first
+     * axis. The generic version sets the values one point at a time.
+     *
+     * @tparam TImage the Image type.
+     */
+    template <typename TImage>
+    struct ImageRowSetter
+    {
+      template <typename TIterator>
+      static void setRow( TImage & anImage, typename TImage::Point aPoint,
+                          TIterator it, unsigned int aWidth )
+      {
+        typename TImage::Point::Coordinate & x = aPoint[ 0 ];
+        for ( unsigned int i = 0; i < aWidth; ++i, ++x, ++it )
+          anImage.setValue( aPoint, *it );
+      }
+    };
+
+    /**
+     * Specialization for ImageContainerBySTLVector: a row along the
+     * first axis is contiguous in its storage, so the values are
+     * copied (and converted) in place.
+     */
+    template <typename TDomain, typename TValue>
+    struct ImageRowSetter< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+
+      template <typename TIterator>
+      static void setRow( Image & anImage, typename Image::Point aPoint,
+                          TIterator it, unsigned int aWidth )
+      {
+        std::copy( it, it + aWidth, 
+                   anImage.begin() + anImage.linearized( aPoint ) );
+      }
+    };
+  } // namespace detail
+
 /////////////////////////////////////////////////////////////////////////////
 // class PNMReader
 /**
@@ -61,6 +105,14 @@ namespace DGtal
  *  - PPM3D: 3D variant of PPM
  *  - PGM3D: 3D variant of PGM
  * 
+ * Pixel values are decoded in bulk: binary data (P5, P3D) is read
+ * one row at a time with a single stream read, and ASCII data (P2,
+ * P2-3D) is decoded in a single pass over the characters of the
+ * stream buffer instead of using formatted extraction for each value;
+ * ASCII values greater than the maxval of the header are rejected.
+ * Decoded rows are copied straight into the storage of an
+ * ImageContainerBySTLVector, other images are filled with setValue.
+ *
  *
  *  Simple example: (extract from test file testPNMReader.cpp)
  * 
@@ -94,6 +146,7 @@ namespace DGtal
 
     typedef TImageContainer ImageContainer;
     typedef typename TImageContainer::Domain::Vector Vector;
+    typedef typename TImageContainer::Point Point;
     
     enum MagicNumber {P1,P2,P3,P4,P5,P6};
     
@@ -117,7 +170,9 @@ namespace DGtal
 
     /** 
      * Main method to import a Pgm3D (8bits) into an instance of the 
-     * template parameter ImageContainer.
+     * template parameter ImageContainer. Both the binary (P3D) and
+     * the ASCII (P2-3D, as produced by PNMWriter) variants are
+     * accepted.
      * 
      * @param filename the file name to import.
      * @return an instance of the ImageContainer.
@@ -125,6 +180,40 @@ namespace DGtal
     static ImageContainer importPGM3D(const std::string & aFilename) throw(DGtal::IOException);
     
     
+    /**
+     * Decodes at most @a aNbValues unsigned integers written in ASCII
+     * from the stream @a in and appends them to @a aBuffer. The
+     * characters are scanned once, straight from the stream buffer;
+     * comments (from '#' to the end of the line) are skipped. The
+     * stream is left right after the last decoded value.
+     *
+     * @param in the input stream, positioned on the first value.
+     * @param aBuffer (returns) the decoded values are appended to it.
+     * @param aNbValues the number of values to decode.
+     * @param aMaxValue the greatest valid value (the PGM maxval).
+     * @return 'true' if @a aNbValues values were decoded, 'false' if
+     * the stream ended early, contained an invalid character or a
+     * value greater than @a aMaxValue.
+     */
+    static bool readASCIIValues( std::istream & in, 
+                                 std::vector<unsigned int> & aBuffer,
+                                 unsigned int aNbValues,
+                                 unsigned int aMaxValue );
+    
+  private:
+
+    /**
+     * Copies @a aWidth decoded values into the image, along the first
+     * axis and starting at point @a aPoint (see detail::ImageRowSetter).
+     *
+     * @param anImage the image to fill.
+     * @param aPoint the first point of the row.
+     * @param it an iterator on the first decoded value of the row.
+     * @param aWidth the number of values in the row.
+     */
+    template <typename TIterator>
+    static void setRow( ImageContainer & anImage, Point aPoint, 
+                        TIterator it, unsigned int aWidth );
     
  }; // end of class  PNMReader
 
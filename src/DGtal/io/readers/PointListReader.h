@@ -76,6 +76,22 @@ namespace DGtal
    vIndice.push_back(2); // select for Y coordinate the third position number of the line.
    vector<Z2i::Point> vectPoints = PointListReader<Z2i::Point>::getPointsFromFile(filename,vectPos);
    *  @endcode
+   *
+   * Files are not parsed through iostreams: getPointsFromFile and
+   * copyPointsFromFile map the whole file in memory (or load it with a
+   * single read when memory mapping is not available), split it into
+   * line-aligned chunks and parse them with a locale-independent
+   * number parser (the '.' is the decimal point whatever the C or C++
+   * locale). Unlike the
+   * stream based getPointsFromInputStream, they also read a last line
+   * which is not terminated by an end of line. When DGtal is built
+   * with OpenMP (WITH_OPENMP), the chunks are parsed in parallel. Points can also be sent to any output
+   * iterator, e.g. to fill a digital set:
+   *  @code
+   Z2i::DigitalSet set( domain );
+   DigitalSetInserter<Z2i::DigitalSet> inserter( set );
+   PointListReader<Z2i::Point>::copyPointsFromFile( filename, inserter );
+   *  @endcode
    *   
    * @see testPointListReader.cpp
    **/
@@ -86,6 +102,8 @@ namespace DGtal
     // ----------------------- Standard services ------------------------------
   public:
 
+    typedef typename TPoint::Component Component;
+
     /** 
      * Main method to import a vector containing a list of points
      * defined in a file where each line defines a point. 
@@ -116,6 +134,46 @@ namespace DGtal
            std::vector<unsigned int>  aVectPosition=std::vector<unsigned int>());
   
 
+    /** 
+     * Imports the points defined in a file where each line defines a
+     * point and writes them, in file order, to an output iterator
+     * (for instance a back_insert_iterator on a reserved vector, or a
+     * DigitalSetInserter).
+     * 
+     * @param filename the file name to import.
+     * @param out the output iterator on TPoint.
+     * @param aVectPosition used to specify the position of indices of
+     * value points  (optional: default set to 0,..,dimension) 
+     * @return the number of points read.
+     **/
+    template <typename TOutputIterator>
+    static unsigned int
+    copyPointsFromFile (const std::string &filename, TOutputIterator out,
+           std::vector<unsigned int>  aVectPosition=std::vector<unsigned int>());
+
+
+    /** 
+     * Parses the points defined in the memory buffer [itb,ite) where
+     * each line defines a point. The buffer is split into @a aNbChunks
+     * line-aligned chunks which are parsed independently (in parallel
+     * with OpenMP), then the points are written in order to @a out.
+     * 
+     * @param itb the beginning of the buffer.
+     * @param ite the end of the buffer.
+     * @param out the output iterator on TPoint.
+     * @param aVectPosition used to specify the position of indices of
+     * value points  (optional: default set to 0,..,dimension) 
+     * @param aNbChunks the number of chunks (default 0: one chunk per
+     * available thread).
+     * @return the number of points read.
+     **/
+    template <typename TOutputIterator>
+    static unsigned int
+    copyPointsFromBuffer (const char *itb, const char *ite, TOutputIterator out,
+           std::vector<unsigned int>  aVectPosition=std::vector<unsigned int>(),
+           unsigned int aNbChunks = 0);
+
+
 
 
 
@@ -158,6 +216,76 @@ namespace DGtal
     static std::vector< FreemanChain< TInteger > > 
     getFreemanChainsFromFile (const std::string &filename);
   
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Read-only view of a whole file in memory: the file is memory
+     * mapped on UNIX systems, and read into a buffer otherwise.
+     */
+    class FileBuffer
+    {
+    public:
+      FileBuffer( const std::string & filename );
+      ~FileBuffer();
+      const char * begin() const;
+      const char * end() const;
+    private:
+      FileBuffer( const FileBuffer & other );
+      FileBuffer & operator=( const FileBuffer & other );
+      const char * myBegin;
+      std::size_t mySize;
+      bool myIsMapped;
+      std::vector<char> myData;
+    };
+
+    /**
+     * Splits the buffer [itb,ite) into the buffers [bounds[i],bounds[i+1])
+     * of roughly equal size, each of them starting at a line start.
+     */
+    static std::vector<const char *>
+    splitLines( const char *itb, const char *ite, unsigned int aNbChunks );
+
+    /**
+     * Parses [itb,ite) as @a aNbChunks line-aligned chunks (in
+     * parallel with OpenMP), the points of the i-th chunk being stored
+     * in aChunks[i].
+     *
+     * @return the total number of points read.
+     * @throw std::out_of_range if @a aVectPosition has less than
+     * TPoint::dimension positions.
+     */
+    static unsigned int
+    parseChunks( const char *itb, const char *ite, 
+                 std::vector<unsigned int> aVectPosition,
+                 unsigned int aNbChunks,
+                 std::vector< std::vector<TPoint> > & aChunks );
+
+    /**
+     * Parses all the lines of [itb,ite) and appends the valid points to
+     * @a aResult.
+     */
+    static void
+    parseLines( const char *itb, const char *ite, 
+                const std::vector<unsigned int> & aVectPosition,
+                std::vector<TPoint> & aResult );
+
+    /**
+     * Parses a number starting at @a it (no leading space), in the way
+     * the formatted stream extraction of a Component in the classic
+     * locale would. Integers are accumulated in 64 bits and rejected
+     * when out of the range of Component. Reals are correctly rounded
+     * (computed exactly when they have at most 19 significant digits
+     * and a small exponent, by a stream in the classic locale
+     * otherwise) and rejected on overflow. @a it is moved after the
+     * parsed characters.
+     *
+     * @return 'true' if a number was read.
+     */
+    static bool
+    parseNumber( const char * & it, const char *ite, Component & aValue );
+
   
   
 
@@ -0,0 +1,282 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BlockWriter.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/19
+ *
+ * Header file for module BlockWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BlockWriter_RECURSES)
+#error Recursive header files inclusion detected in BlockWriter.h
+#else // defined(BlockWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BlockWriter_RECURSES
+
+#if !defined BlockWriter_h
+/** Prevents repeated inclusion of headers. */
+#define BlockWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/type_traits.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/Color.h"
+#include "DGtal/io/colormaps/CColorMap.h"
+#include "DGtal/io/colormaps/GrayscaleColorMap.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /**
+     * Gives access to consecutive blocks of values of an image, in
+     * the order of its domain. The generic version copies the values
+     * read through the domain iterator into an internal buffer.
+     *
+     * @tparam TImage the Image type.
+     */
+    template <typename TImage>
+    struct ImageBlockFetcher
+    {
+      typedef typename TImage::Value Value;
+
+      ImageBlockFetcher( const TImage & aImage )
+        : myImage( aImage ), myIt( aImage.domain().begin() )
+      {}
+
+      /**
+       * @param aSize the number of values to fetch.
+       * @return a pointer to the next @a aSize contiguous values.
+       */
+      const Value * next( std::size_t aSize )
+      {
+        myBuffer.resize( aSize );
+        for ( std::size_t i = 0; i < aSize; ++i, ++myIt )
+          myBuffer[ i ] = myImage( *myIt );
+        return aSize != 0 ? &myBuffer[ 0 ] : 0;
+      }
+
+      const TImage & myImage;
+      typename TImage::Domain::ConstIterator myIt;
+      std::vector<Value> myBuffer;
+    };
+
+    /**
+     * Specialization for ImageContainerBySTLVector: its storage order
+     * is the domain order, so blocks are read in place.
+     */
+    template <typename TDomain, typename TValue>
+    struct ImageBlockFetcher< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      typedef TValue Value;
+      typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+
+      ImageBlockFetcher( const Image & aImage )
+        : myIt( aImage.begin() )
+      {}
+
+      const Value * next( std::size_t aSize )
+      {
+        const Value * values = aSize != 0 ? &( *myIt ) : 0;
+        myIt += aSize;
+        return values;
+      }
+
+      typename Image::ConstIterator myIt;
+    };
+
+    /**
+     * Specialization for ImageContainerBySTLVector on bool values:
+     * std::vector<bool> does not store addressable values, so they are
+     * copied into an internal buffer as in the generic version (which
+     * cannot be a std::vector<bool> either).
+     */
+    template <typename TDomain>
+    struct ImageBlockFetcher< ImageContainerBySTLVector<TDomain, bool> >
+    {
+      typedef bool Value;
+      typedef ImageContainerBySTLVector<TDomain, bool> Image;
+
+      ImageBlockFetcher( const Image & aImage )
+        : myIt( aImage.begin() ), myCapacity( 0 )
+      {}
+
+      const Value * next( std::size_t aSize )
+      {
+        if ( aSize > myCapacity )
+          {
+            myBuffer.reset( new Value[ aSize ] );
+            myCapacity = aSize;
+          }
+        for ( std::size_t i = 0; i < aSize; ++i, ++myIt )
+          myBuffer[ i ] = *myIt;
+        return aSize != 0 ? myBuffer.get() : 0;
+      }
+
+      typename Image::ConstIterator myIt;
+      boost::scoped_array<Value> myBuffer;
+      std::size_t myCapacity;
+    };
+
+    /**
+     * Converts a span of values into gray levels, i.e. the mean of
+     * the red, green and blue channels of their colormap color.
+     *
+     * @tparam TColormap a model of CColorMap.
+     */
+    template <typename TColormap>
+    struct GrayLevelConverter
+    {
+      typedef typename TColormap::Value Value;
+
+      template <typename TWord>
+      static void convert( const TColormap & aColormap,
+                           const Value * itb, const Value * ite, TWord * out )
+      {
+        for ( ; itb != ite; ++itb, ++out )
+          {
+            const Color col = aColormap( *itb );
+            *out = (TWord) ( ( (int)col.red() + (int)col.green() + (int)col.blue() ) / 3 );
+          }
+      }
+    };
+
+    /**
+     * Specialization for GrayscaleColorMap: the gray level is computed
+     * directly, in a loop the compiler can vectorize.
+     */
+    template <typename TValue>
+    struct GrayLevelConverter< GrayscaleColorMap<TValue> >
+    {
+      typedef TValue Value;
+
+      template <typename TWord>
+      static void convert( const GrayscaleColorMap<TValue> & aColormap,
+                           const Value * itb, const Value * ite, TWord * out )
+      {
+        const Value min = aColormap.min();
+        const double range = static_cast<double>( aColormap.max() - min );
+        const std::size_t n = ite - itb;
+        for ( std::size_t i = 0; i < n; ++i )
+          out[ i ] = (TWord) static_cast<unsigned char>
+            ( 255.0 * ( static_cast<double>( itb[ i ] - min ) / range ) );
+      }
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BlockWriter
+  /**
+   * Description of template struct 'BlockWriter' <p>
+   * \brief Aim: Buffered binary export of the gray levels of an
+   * image, used by RawWriter, VolWriter and LongvolWriter.
+   *
+   * The values of the image are processed by blocks of contiguous
+   * points in the domain order: each block is fetched (in place for
+   * ImageContainerBySTLVector), converted through the colormap in one
+   * loop (directly computed for GrayscaleColorMap), encoded as
+   * little-endian words and sent to the stream with a single write.
+   *
+   * When DGtal is built with OpenMP (WITH_OPENMP), the export can be
+   * double-buffered: the next block is converted while the previous
+   * one is written.
+   *
+   * @code
+   * std::ofstream out( "image.raw", std::ios_base::binary );
+   * BlockWriter<Image, Gray>::exportWords<unsigned char>( out, image, Gray( 0, 255 ) );
+   * @endcode
+   *
+   * @tparam TImage the Image type.
+   * @tparam TColormap the type of the colormap to use in the export.
+   */
+  template <typename TImage, typename TColormap>
+  struct BlockWriter
+  {
+    // ----------------------- Standard services ------------------------------
+
+    BOOST_CONCEPT_ASSERT((CColorMap<TColormap>));
+
+    BOOST_STATIC_ASSERT((boost::is_same< typename TColormap::Value,
+       typename TImage::Value>::value));
+
+    typedef TImage Image;
+    typedef typename TImage::Value Value;
+    typedef TColormap Colormap;
+
+    /// Default number of points per block.
+    static const std::size_t DefaultBlockSize = 1 << 20;
+
+    /**
+     * Writes the gray levels of all the points of the image domain
+     * as little-endian words of type TWord.
+     *
+     * @tparam TWord the unsigned integer type of the written words.
+     * @param out the output stream (opened in binary mode).
+     * @param aImage the image to export.
+     * @param aColormap the colormap.
+     * @param aBlockSize the number of points per block.
+     * @param asynchronous when 'true' and OpenMP is available, the
+     * conversion of a block overlaps the writing of the previous one.
+     *
+     * @return true if no errors occur.
+     */
+    template <typename TWord>
+    static bool exportWords( std::ostream & out, const Image & aImage,
+                             const Colormap & aColormap,
+                             std::size_t aBlockSize = DefaultBlockSize,
+                             bool asynchronous = true );
+
+  private:
+
+    /**
+     * Fetches, converts and encodes the next @a aSize points into @a
+     * aBytes.
+     */
+    template <typename TWord>
+    static void encodeBlock( detail::ImageBlockFetcher<Image> & aFetcher,
+                             const Colormap & aColormap, std::size_t aSize,
+                             std::vector<TWord> & aWords,
+                             std::vector<char> & aBytes );
+  };
+}//namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/BlockWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BlockWriter_h
+
+#undef BlockWriter_RECURSES
+#endif // else defined(BlockWriter_RECURSES)
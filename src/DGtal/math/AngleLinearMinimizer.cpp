@@ -31,9 +31,73 @@
  */
 
 ///////////////////////////////////////////////////////////////////////////////
+#include <cmath>
 #include "DGtal/math/AngleLinearMinimizer.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 ///////////////////////////////////////////////////////////////////////////////
 
+///////////////////////////////////////////////////////////////////////////////
+// Branch-free angle computations, used by the loops of optimizeSweeps
+// so that they may be vectorized.
+///////////////////////////////////////////////////////////////////////////////
+
+/// The period used by AngleComputer.
+static const double TWO_PI = (float)(M_PI*2.0);
+
+/// Same as AngleComputer::cast, for any angle in [-2pi:4pi].
+static inline double castAngle( double i )
+{
+  i += ( i < 0.0 ) ? TWO_PI : 0.0;
+  return i - ( ( i > TWO_PI ) ? TWO_PI : 0.0 );
+}
+
+/// Same as AngleComputer::cast, for any angle below 2^31 * 2pi in
+/// absolute value.
+static inline double castAnyAngle( double i )
+{
+  return castAngle( i - TWO_PI * (double) (int) ( i / TWO_PI ) );
+}
+
+/// Same as AngleComputer::less.
+static inline bool lessAngle( double i, double j )
+{
+  const double d = j - i;
+  return ( ( d > 0.0 ) & ( d < M_PI ) ) | ( d <= -M_PI );
+}
+
+/// Same as AngleComputer::deviation.
+static inline double deviationAngle( double j, double i )
+{
+  const double d = j - i;
+  return d - ( ( d >= M_PI ) ? TWO_PI : 0.0 ) + ( ( d <= -M_PI ) ? TWO_PI : 0.0 );
+}
+
+/// @return the angle @a mid, bounded by @a min and @a max.
+static inline double clampAngle( double mid, double min, double max )
+{
+  mid = lessAngle( mid, min ) ? min : mid;
+  return lessAngle( max, mid ) ? max : mid;
+}
+
+/// @return the point of the straight line joining the values @a
+/// valp and @a valn (at distances @a distp and @a dist) of the value
+/// in between.
+static inline double middleAngle( double valp, double valn,
+                                  double distp, double dist )
+{
+  return castAngle( ( distp * deviationAngle( valn, valp ) ) 
+                    / ( dist + distp ) + valp );
+}
+
+/// @return the value @a old moved halfway towards @a mid, as in
+/// AngleLinearMinimizer::oneStep.
+static inline double halfStepAngle( double old, double mid )
+{
+  return castAngle( old + 0.5 * deviationAngle( mid, old ) );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // class AngleLinearMinimizer
 ///////////////////////////////////////////////////////////////////////////////
@@ -243,6 +307,130 @@ DGtal::AngleLinearMinimizer::optimize( unsigned int i1, unsigned int i2 )
 }
 
 
+unsigned int
+DGtal::AngleLinearMinimizer::optimizeSweeps( double epsilon, 
+                                             unsigned int maxNbIterations,
+                                             bool computeEnergies,
+                                             unsigned int nbThreads )
+{
+  ASSERT( size() > 2 );
+  if ( nbThreads == 0 )
+    {
+#ifdef WITH_OPENMP
+      nbThreads = omp_get_max_threads();
+#else
+      nbThreads = 1;
+#endif
+    }
+  const unsigned int n = size();
+  mySoAValues.resize( n );
+  mySoAOldValues.resize( n );
+  mySoAMins.resize( n );
+  mySoAMaxs.resize( n );
+  mySoADistToNext.resize( n );
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      const ValueInfo & vi = this->ro( i );
+      mySoAValues[ i ] = AngleComputer::cast( vi.value );
+      mySoAMins[ i ] = AngleComputer::cast( vi.min );
+      mySoAMaxs[ i ] = AngleComputer::cast( vi.max );
+      mySoADistToNext[ i ] = vi.distToNext;
+    }
+
+  myIterations.clear();
+  unsigned int nbIterations = 0;
+  do
+    {
+      mySoAOldValues = mySoAValues;
+      this->oneSweep( nbThreads );
+
+      mySum = 0.0;
+      myMax = 0.0;
+      for ( unsigned int i = 0; i < n; ++i )
+        {
+          double diff = fabs( deviationAngle( mySoAValues[ i ], 
+                                              mySoAOldValues[ i ] ) );
+          if ( diff > myMax )
+            myMax = diff;
+          mySum += diff;
+        }
+      IterationInfo info;
+      info.sum = mySum;
+      info.max = myMax;
+      info.energy = computeEnergies ? sweepEnergy( mySoAValues ) : -1.0;
+      myIterations.push_back( info );
+      ++nbIterations;
+    }
+  while ( ( mySum > epsilon ) && ( nbIterations < maxNbIterations ) );
+
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      ValueInfo & vi = this->rw( i );
+      vi.value = mySoAValues[ i ];
+      vi.oldValue = mySoAOldValues[ i ];
+    }
+  return nbIterations;
+}
+
+
+double
+DGtal::AngleLinearMinimizer::sweepEnergy( const std::vector<double> & values ) const
+{
+  const int n = size();
+  const double* dist = &mySoADistToNext[ 0 ];
+  double E = 0.0;
+  for ( int i = 1; i < n; ++i )
+    {
+      double dev = deviationAngle( values[ i ], values[ i - 1 ] );
+      E += ( dev * dev ) / dist[ i - 1 ];
+    }
+  if ( ! myIsCurveOpen )
+    {
+      double dev = deviationAngle( values[ 0 ], values[ n - 1 ] );
+      E += ( dev * dev ) / dist[ n - 1 ];
+    }
+  return E;
+}
+
+
+void
+DGtal::AngleLinearMinimizer::sweepGradientDescent( double step, 
+                                                   unsigned int nbThreads )
+{
+#ifndef WITH_OPENMP
+  (void) nbThreads;
+#endif
+  const int n = size();
+  const double* old = &mySoAOldValues[ 0 ];
+  const double* dist = &mySoADistToNext[ 0 ];
+  const double* mins = &mySoAMins[ 0 ];
+  const double* maxs = &mySoAMaxs[ 0 ];
+  double* value = &mySoAValues[ 0 ];
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) num_threads(nbThreads) if(nbThreads > 1)
+#endif
+  for ( int i = 1; i < n - 1; ++i )
+    {
+      double grad = 2.0 * ( deviationAngle( old[ i ], old[ i - 1 ] ) / dist[ i - 1 ]
+                            - deviationAngle( old[ i + 1 ], old[ i ] ) / dist[ i ] );
+      value[ i ] = clampAngle( castAnyAngle( old[ i ] - step * grad ),
+                               mins[ i ], maxs[ i ] );
+    }
+  // extremities.
+  double grad0 = -2.0 * deviationAngle( old[ 1 ], old[ 0 ] ) / dist[ 0 ];
+  double gradn = 2.0 * deviationAngle( old[ n - 1 ], old[ n - 2 ] ) / dist[ n - 2 ];
+  if ( ! myIsCurveOpen )
+    {
+      grad0 += 2.0 * deviationAngle( old[ 0 ], old[ n - 1 ] ) / dist[ n - 1 ];
+      gradn -= 2.0 * deviationAngle( old[ 0 ], old[ n - 1 ] ) / dist[ n - 1 ];
+    }
+  value[ 0 ] = clampAngle( castAnyAngle( old[ 0 ] - step * grad0 ),
+                           mins[ 0 ], maxs[ 0 ] );
+  value[ n - 1 ] = clampAngle( castAnyAngle( old[ n - 1 ] - step * gradn ),
+                               mins[ n - 1 ], maxs[ n - 1 ] );
+}
+
+
 double
 DGtal::AngleLinearMinimizer::lastDelta() const
 {
@@ -300,6 +488,39 @@ DGtal::AngleLinearMinimizer::oneStep( unsigned int i1, unsigned int i2 )
 }
 
 
+void
+DGtal::AngleLinearMinimizer::oneSweep( unsigned int nbThreads )
+{
+#ifndef WITH_OPENMP
+  (void) nbThreads;
+#endif
+  const int n = size();
+  const double* old = &mySoAOldValues[ 0 ];
+  const double* dist = &mySoADistToNext[ 0 ];
+  const double* mins = &mySoAMins[ 0 ];
+  const double* maxs = &mySoAMaxs[ 0 ];
+  double* value = &mySoAValues[ 0 ];
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) num_threads(nbThreads) if(nbThreads > 1)
+#endif
+  for ( int i = 1; i < n - 1; ++i )
+    {
+      double mid = middleAngle( old[ i - 1 ], old[ i + 1 ], dist[ i - 1 ], dist[ i ] );
+      value[ i ] = halfStepAngle( old[ i ], clampAngle( mid, mins[ i ], maxs[ i ] ) );
+    }
+  // extremities.
+  double mid0 = myIsCurveOpen 
+    ? old[ 1 ] 
+    : middleAngle( old[ n - 1 ], old[ 1 ], dist[ n - 1 ], dist[ 0 ] );
+  double midn = myIsCurveOpen 
+    ? old[ n - 2 ]
+    : middleAngle( old[ n - 2 ], old[ 0 ], dist[ n - 2 ], dist[ n - 1 ] );
+  value[ 0 ] = halfStepAngle( old[ 0 ], clampAngle( mid0, mins[ 0 ], maxs[ 0 ] ) );
+  value[ n - 1 ] = halfStepAngle( old[ n - 1 ], 
+                                  clampAngle( midn, mins[ n - 1 ], maxs[ n - 1 ] ) );
+}
+
+
 
 void
 DGtal::AngleLinearMinimizerByRelaxation::oneStep( unsigned int i1, unsigned int i2 )
@@ -349,6 +570,45 @@ DGtal::AngleLinearMinimizerByRelaxation::oneStep( unsigned int i1, unsigned int
 
 
 
+void
+DGtal::AngleLinearMinimizerByRelaxation::oneSweep( unsigned int nbThreads )
+{
+#ifndef WITH_OPENMP
+  (void) nbThreads;
+#endif
+  const int n = size();
+  const double* dist = &mySoADistToNext[ 0 ];
+  const double* mins = &mySoAMins[ 0 ];
+  const double* maxs = &mySoAMaxs[ 0 ];
+  double* value = &mySoAValues[ 0 ];
+  // the first value, from the old ones, as in oneStep.
+  double mid0 = myIsCurveOpen 
+    ? value[ 1 ]
+    : middleAngle( value[ n - 1 ], value[ 1 ], dist[ n - 1 ], dist[ 0 ] );
+  value[ 0 ] = clampAngle( mid0, mins[ 0 ], maxs[ 0 ] );
+  // the even values, then the odd ones, up to n-2.
+  for ( int color = 0; color < 2; ++color )
+    {
+      const int nb = ( n - 2 - color ) / 2 + 1;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) num_threads(nbThreads) if(nbThreads > 1)
+#endif
+      for ( int k = 1 - color; k < nb; ++k )
+        {
+          const int i = 2 * k + color;
+          double mid = middleAngle( value[ i - 1 ], value[ i + 1 ], 
+                                    dist[ i - 1 ], dist[ i ] );
+          value[ i ] = clampAngle( mid, mins[ i ], maxs[ i ] );
+        }
+    }
+  // the last value, from the updated ones, as in oneStep.
+  double midn = myIsCurveOpen 
+    ? value[ n - 2 ]
+    : middleAngle( value[ n - 2 ], value[ 0 ], dist[ n - 2 ], dist[ n - 1 ] );
+  value[ n - 1 ] = clampAngle( midn, mins[ n - 1 ], maxs[ n - 1 ] );
+}
+
+
 double
 DGtal::AngleLinearMinimizerByRelaxation::lastDelta() const
 {
@@ -385,6 +645,13 @@ DGtal::AngleLinearMinimizerByGradientDescent::oneStep( unsigned int i1, unsigned
 
 
 
+void
+DGtal::AngleLinearMinimizerByGradientDescent::oneSweep( unsigned int nbThreads )
+{
+  sweepGradientDescent( myStep, nbThreads );
+}
+
+
 double
 DGtal::AngleLinearMinimizerByGradientDescent::lastDelta() const
 {
@@ -443,6 +710,24 @@ DGtal::AngleLinearMinimizerByAdaptiveStepGradientDescent::oneStep( unsigned int
 
 
 
+void
+DGtal::AngleLinearMinimizerByAdaptiveStepGradientDescent::oneSweep( unsigned int nbThreads )
+{
+  sweepGradientDescent( myStep, nbThreads );
+  double E1 = sweepEnergy( mySoAOldValues );
+  double E2 = sweepEnergy( mySoAValues );
+  if ( E1 <= E2 )
+    {
+      myStep /= 4.0;
+    }
+  else
+    {
+      /* doubling step. */
+      myStep *= 2.0;
+    }
+}
+
+
 double
 DGtal::AngleLinearMinimizerByAdaptiveStepGradientDescent::lastDelta() const
 {
@@ -100,6 +100,29 @@ public:
     double distToNext;
     
   };
+
+  /**
+   * Stores the convergence information of one iteration of
+   * optimizeSweeps.
+   */
+  struct IterationInfo
+  {
+    /**
+     * Sum of all the absolute displacements of the iteration.
+     */
+    double sum;
+
+    /**
+     * Max of all the absolute displacements of the iteration.
+     */
+    double max;
+
+    /**
+     * The energy after the iteration (see sweepEnergy), or -1.0 when
+     * energies are not computed.
+     */
+    double energy;
+  };
   
 
 
@@ -236,6 +259,40 @@ public:
    */
    double max() const;
 
+  /**
+   * Iterates the optimization of all values, like repeated calls to
+   * optimize() until the sum of the displacements is not greater than
+   * @a epsilon, but on a structure of arrays: the values, bounds and
+   * distances are copied into contiguous arrays at the beginning,
+   * and the values and old values are copied back into the ValueInfo
+   * structures at the end. Each iteration is performed by oneSweep,
+   * which may be overriden, whose loops use branch-free angle
+   * computations so that the compiler may vectorize them, and may be
+   * shared between several threads when OpenMP is available.
+   *
+   * Values and bounds are cast into [0:2pi[ when copied.
+   *
+   * @param epsilon the iterations stop when the sum of the
+   * displacements is not greater than epsilon.
+   * @param maxNbIterations the maximal number of iterations.
+   * @param computeEnergies when 'true', the energy of the system is
+   * computed after each iteration (see iterations()).
+   * @param nbThreads the number of threads (0 for all the available
+   * threads).
+   * @return the number of iterations.
+   * @see oneSweep iterations
+   */
+  unsigned int optimizeSweeps( double epsilon, 
+                               unsigned int maxNbIterations,
+                               bool computeEnergies = false,
+                               unsigned int nbThreads = 1 );
+
+  /**
+   * @return the convergence information of each iteration of the
+   * last call to optimizeSweeps.
+   */
+   const std::vector<IterationInfo> & iterations() const;
+
  
 protected:
 
@@ -250,6 +307,36 @@ protected:
    */
   virtual void oneStep( unsigned int i1, unsigned int i2 );
 
+  /**
+   * The method which performs one iteration of optimizeSweeps on all
+   * values, stored in the arrays mySoAValues, mySoAOldValues, etc. The
+   * user may override it. Before the call, mySoAValues and
+   * mySoAOldValues are equal. Afterwards, mySoAValues should contain
+   * the new values. Moves each value as oneStep.
+   *
+   * @param nbThreads the number of threads.
+   */
+  virtual void oneSweep( unsigned int nbThreads );
+
+  /**
+   * One step of gradient descent on the arrays of optimizeSweeps,
+   * the gradient being computed at the old values (see
+   * getFormerGradient).
+   *
+   * @param step the step for the gradient descent.
+   * @param nbThreads the number of threads.
+   */
+  void sweepGradientDescent( double step, unsigned int nbThreads );
+
+  /**
+   * @param values the values of the arrays of optimizeSweeps
+   * (mySoAValues or mySoAOldValues).
+   * @return the energy of the system for these values, that is
+   * getEnergy( 0, 0 ) plus, when the curve is closed, the term
+   * between the last and the first values.
+   */
+  double sweepEnergy( const std::vector<double> & values ) const;
+
 
 public:
   /**
@@ -315,6 +402,16 @@ protected:
    */
   unsigned int mySize;
 
+  /**
+   * The values, old values, lower bounds, upper bounds and distances
+   * to the next value, stored as arrays by optimizeSweeps.
+   */
+  std::vector<double> mySoAValues;
+  std::vector<double> mySoAOldValues;
+  std::vector<double> mySoAMins;
+  std::vector<double> mySoAMaxs;
+  std::vector<double> mySoADistToNext;
+
 private:
   
   /**
@@ -337,6 +434,12 @@ private:
    */
   double myMax;
 
+  /**
+   * The convergence information of each iteration of the last call
+   * to optimizeSweeps.
+   */
+  std::vector<IterationInfo> myIterations;
+
   // ------------------------- Hidden services ------------------------------
 
   
@@ -394,6 +497,17 @@ private:
      */
     virtual void oneStep( unsigned int i1, unsigned int i2 );
 
+    /**
+     * One iteration of optimizeSweeps by relaxation. The values are
+     * updated in red-black order: the even values, then the odd
+     * ones, which are computed in parallel, each one from its
+     * already updated neighbors. It converges to the same values as
+     * oneStep, whose order is sequential.
+     *
+     * @param nbThreads the number of threads.
+     */
+    virtual void oneSweep( unsigned int nbThreads );
+
 public:
     /**
      * Should be used to stop the minimization process. The smaller is
@@ -452,6 +566,13 @@ public:
      */
     virtual void oneStep( unsigned int i1, unsigned int i2 );
 
+    /**
+     * One iteration of optimizeSweeps by gradient descent.
+     *
+     * @param nbThreads the number of threads.
+     */
+    virtual void oneSweep( unsigned int nbThreads );
+
 public:
     /**
      * Should be used to stop the minimization process. The smaller is
@@ -510,6 +631,14 @@ public:
      */
     virtual void oneStep( unsigned int i1, unsigned int i2 );
 
+    /**
+     * One iteration of optimizeSweeps by gradient descent, the step
+     * being adapted as in oneStep.
+     *
+     * @param nbThreads the number of threads.
+     */
+    virtual void oneSweep( unsigned int nbThreads );
+
 public:
     /**
      * Should be used to stop the minimization process. The smaller is
@@ -0,0 +1,383 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MPolynomialProgram.h
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/29
+ *
+ * Header file for module MPolynomialProgram.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see MPolynomial.h testMPolynomial.cpp testMPolynomial-benchmark.cpp
+ */
+
+#if defined(MPolynomialProgram_RECURSES)
+#error Recursive header files inclusion detected in MPolynomialProgram.h
+#else // defined(MPolynomialProgram_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MPolynomialProgram_RECURSES
+
+#if !defined MPolynomialProgram_h
+/** Prevents repeated inclusion of headers. */
+#define MPolynomialProgram_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <math.h>
+#include <boost/type_traits/is_floating_point.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /**
+       Flattens a polynomial of \a n variables into the arrays of an
+       MPolynomialProgram (see MPolynomialProgram for the layout).
+    */
+    template <int n, typename TRing, typename TAlloc>
+    struct MPolynomialProgramCompiler
+    {
+      static void compile( const MPolynomial<n, TRing, TAlloc> & p,
+                           std::vector<int> & degrees,
+                           std::vector<TRing> & coefficients );
+    };
+
+    /**
+       Specialization for univariate polynomials, whose coefficients
+       are stored.
+    */
+    template <typename TRing, typename TAlloc>
+    struct MPolynomialProgramCompiler<1, TRing, TAlloc>
+    {
+      static void compile( const MPolynomial<1, TRing, TAlloc> & p,
+                           std::vector<int> & degrees,
+                           std::vector<TRing> & coefficients );
+    };
+
+    /**
+       Outward rounding of interval bounds: for floating-point rings,
+       a bound computed with rounding to nearest is moved one ulp
+       towards -infinity (down) or +infinity (up), so that it bounds
+       the exact result. Nothing is done for exact rings.
+    */
+    template <typename TRing, 
+              bool isFloatingPoint = boost::is_floating_point<TRing>::value>
+    struct IntervalRounding
+    {
+      static TRing down( const TRing & v ) { return v; }
+      static TRing up( const TRing & v ) { return v; }
+    };
+
+    template <typename TRing>
+    struct IntervalRounding<TRing, true>
+    {
+      static TRing down( const TRing & v ) 
+      { return next( v, -std::numeric_limits<TRing>::infinity() ); }
+      static TRing up( const TRing & v ) 
+      { return next( v, std::numeric_limits<TRing>::infinity() ); }
+    private:
+      static float next( float v, float to ) { return ::nextafterf( v, to ); }
+      static double next( double v, double to ) { return ::nextafter( v, to ); }
+      static long double next( long double v, long double to ) 
+      { return ::nextafterl( v, to ); }
+    };
+
+    /**
+       Interval product and sum: [vlo,vup] becomes an interval
+       containing [vlo,vup] * [xlo,xup] + [clo,cup], rounded outward
+       (see IntervalRounding).
+    */
+    template <typename TRing>
+    void intervalMulAdd( TRing & vlo, TRing & vup,
+                         const TRing & xlo, const TRing & xup,
+                         const TRing & clo, const TRing & cup );
+
+    /**
+       Evaluates the flattened polynomial of the \a k last variables
+       of a MPolynomialProgram of \a n variables, whose degrees and
+       coefficients start at \a d and \a c (which are moved after
+       them). The recursion on \a k is resolved at compile time.
+    */
+    template <int k, int n, typename TRing, unsigned int B>
+    struct MPolynomialProgramNode
+    {
+      typedef MPolynomialProgramNode<k - 1, n, TRing, B> Child;
+
+      /// @return the value at \a x (the k last coordinates).
+      static TRing eval( const TRing* x, const int* & d, const TRing* & c );
+
+      /// @return the value at \a x, the k partial derivatives being
+      /// written in \a grad.
+      static TRing evalWithGradient( const TRing* x, TRing* grad,
+                                     const int* & d, const TRing* & c );
+
+      /// Computes an interval [vlo,vup] containing the values over
+      /// the box [lo,up] (the k last coordinates).
+      static void evalInterval( const TRing* lo, const TRing* up,
+                                TRing & vlo, TRing & vup,
+                                const int* & d, const TRing* & c );
+
+      /// Evaluates at nb <= B points of coordinates \a x (the k
+      /// last ones), the values being written in values[ 0 ].
+      static void evalBatch( const TRing* const* x, unsigned int nb,
+                             const int* & d, const TRing* & c,
+                             TRing (*values)[ B ] );
+
+      /// Same as evalBatch, the derivative with respect to the
+      /// j-th of the k last variables being written in grads[ 0 ][ j ].
+      static void evalWithGradientBatch( const TRing* const* x, unsigned int nb,
+                                         const int* & d, const TRing* & c,
+                                         TRing (*values)[ B ],
+                                         TRing (*grads)[ n ][ B ] );
+    };
+
+    /**
+       Specialization for the last variable, whose coefficients are
+       stored.
+    */
+    template <int n, typename TRing, unsigned int B>
+    struct MPolynomialProgramNode<1, n, TRing, B>
+    {
+      static TRing eval( const TRing* x, const int* & d, const TRing* & c );
+      static TRing evalWithGradient( const TRing* x, TRing* grad,
+                                     const int* & d, const TRing* & c );
+      static void evalInterval( const TRing* lo, const TRing* up,
+                                TRing & vlo, TRing & vup,
+                                const int* & d, const TRing* & c );
+      static void evalBatch( const TRing* const* x, unsigned int nb,
+                             const int* & d, const TRing* & c,
+                             TRing (*values)[ B ] );
+      static void evalWithGradientBatch( const TRing* const* x, unsigned int nb,
+                                         const int* & d, const TRing* & c,
+                                         TRing (*values)[ B ],
+                                         TRing (*grads)[ n ][ B ] );
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MPolynomialProgram
+  /**
+     Description of template class 'MPolynomialProgram' <p>
+
+     \brief Aim: Evaluates a multivariate polynomial (MPolynomial)
+     and its gradient by a nested Horner scheme stored in two flat
+     arrays.
+
+     Evaluating a MPolynomial<n, Ring> as P(x)(y)(z) goes through a
+     chain of evaluator objects, which reads the coefficients through
+     the vectors of pointers of MPolynomial and computes the powers of
+     each variable, and its gradient needs n derivative polynomials
+     evaluated in the same way. A MPolynomialProgram is compiled once
+     from the polynomial: each polynomial of k variables is seen as a
+     univariate polynomial in its first variable, whose coefficients
+     are polynomials of k-1 variables, and is stored as its degree
+     followed by its coefficients, from the leading one to the
+     constant one. The degrees are stored in one array, the
+     coefficients of the univariate polynomials in the last variable
+     in another one. Evaluating the polynomial, or the polynomial and
+     its gradient, is a single traversal of these arrays by a nested
+     Horner scheme, without any memory allocation.
+
+     The polynomial is evaluated at a single point or at many points
+     given as one array per coordinate. In the latter case, the
+     points are processed by blocks of BlockSize points, the
+     innermost loops running over the points of a block, so that the
+     compiler may vectorize them (e.g. with -O3 and the SIMD
+     instructions of the target).
+
+     @code
+     MPolynomial<3, double> P = mmonomial<double>( 2, 0, 0 )
+       + mmonomial<double>( 0, 2, 0 ) + mmonomial<double>( 0, 0, 2 ) - 1;
+     MPolynomialProgram<3, double> prog( P );
+     double x[ 3 ] = { 0.5, 0.5, 0.5 };
+     double grad[ 3 ];
+     double v = prog.evalWithGradient( x, grad ); // -0.25 (1,1,1)
+     @endcode
+
+     @tparam n the number of variables or indeterminates (n >= 1).
+     @tparam TRing the type of the coefficients and of the values.
+     @tparam TAlloc the allocator of the polynomial.
+  */
+  template < int n, typename TRing,
+             typename TAlloc = std::allocator<TRing> >
+  class MPolynomialProgram
+  {
+    BOOST_STATIC_ASSERT(( n >= 1 ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TRing Ring;
+    typedef TAlloc Alloc;
+    typedef MPolynomial<n, Ring, Alloc> Polynomial;
+
+    /// Number of points evaluated together in batch evaluations.
+    static const unsigned int BlockSize = 64;
+    typedef detail::MPolynomialProgramNode<n, n, Ring, BlockSize> Node;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The program evaluates the zero polynomial.
+    */
+    MPolynomialProgram();
+
+    /**
+       Constructor from a polynomial.
+       @param p any polynomial.
+    */
+    MPolynomialProgram( const Polynomial & p );
+
+    /**
+       Compiles the polynomial \a p.
+       @param p any polynomial.
+    */
+    void init( const Polynomial & p );
+
+    /**
+       @return the number of stored coefficients.
+    */
+    unsigned int size() const;
+
+    // ----------------------- Evaluation services ----------------------------
+  public:
+
+    /**
+       @param x the n coordinates of the point.
+       @return the value of the polynomial at \a x.
+    */
+    Ring eval( const Ring* x ) const;
+
+    /**
+       @param x the n coordinates of the point.
+       @param grad (returns) the n partial derivatives of the
+       polynomial at \a x.
+       @return the value of the polynomial at \a x.
+    */
+    Ring evalWithGradient( const Ring* x, Ring* grad ) const;
+
+    /**
+       Bounds the polynomial over a box by the same nested Horner
+       scheme in interval arithmetic. The interval may be much larger
+       than the range of the polynomial over the box, but contains
+       it, and shrinks with the box. For floating-point rings, each
+       bound is rounded outward, so that the interval also contains
+       the exact range and the values computed by eval.
+
+       @param lo the n lowest coordinates of the box.
+       @param up the n highest coordinates of the box.
+       @param vlo (returns) a lower bound of the polynomial over the box.
+       @param vup (returns) an upper bound of the polynomial over the box.
+    */
+    void evalInterval( const Ring* lo, const Ring* up,
+                       Ring & vlo, Ring & vup ) const;
+
+    /**
+       @param aPoint any point with n coordinates convertible to Ring.
+       @return the value of the polynomial at \a aPoint.
+    */
+    template <typename TPoint>
+    Ring operator()( const TPoint & aPoint ) const;
+
+    /**
+       Evaluates the polynomial at \a nb points.
+
+       @param nb the number of points.
+       @param coords the n arrays of \a nb coordinates of the points
+       (coords[ k ][ i ] is the k-th coordinate of the i-th point).
+       @param values (returns) the array of the \a nb values.
+    */
+    void evalBatch( unsigned int nb, const Ring* const* coords,
+                    Ring* values ) const;
+
+    /**
+       Evaluates the polynomial and its gradient at \a nb points.
+
+       @param nb the number of points.
+       @param coords the n arrays of \a nb coordinates of the points
+       (coords[ k ][ i ] is the k-th coordinate of the i-th point).
+       @param values (returns) the array of the \a nb values.
+       @param grads (returns) the n arrays of \a nb partial
+       derivatives (grads[ k ][ i ] is the derivative with respect to
+       the k-th variable at the i-th point).
+    */
+    void evalWithGradientBatch( unsigned int nb, const Ring* const* coords,
+                                Ring* values, Ring* const* grads ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Degrees of the nested univariate polynomials, in prefix order.
+    std::vector<int> myDegrees;
+    /// Coefficients of the univariate polynomials in the last variable.
+    std::vector<Ring> myCoefficients;
+
+  }; // end of class MPolynomialProgram
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MPolynomialProgram'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MPolynomialProgram' to write.
+   * @return the output stream after the writing.
+   */
+  template <int n, typename TRing, typename TAlloc>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const MPolynomialProgram<n, TRing, TAlloc> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/MPolynomialProgram.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MPolynomialProgram_h
+
+#undef MPolynomialProgram_RECURSES
+#endif // else defined(MPolynomialProgram_RECURSES)
@@ -154,6 +154,55 @@ namespace DGtal
      */
     double computeCentroidB(const std::vector<double> &a,const std::vector<double> &b);
 
+    /**
+     * Compute the measures of a set of polygons in the (a,b)-parameter
+     * space, given as a packed polygon soup: the vertices of the k-th
+     * polygon are (a[i],b[i]) for i from offsets[k] included to
+     * offsets[k+1] excluded.
+     *
+     * Same values as computeMeasure on each polygon, up to rounding
+     * errors. The square roots are computed once per vertex and the
+     * edge terms in a single loop over all the edges, whose tests the
+     * compiler may turn into selects to vectorize it. The polygons
+     * may be shared between several threads when OpenMP is available.
+     * An empty polygon has a measure (and a centroid) 0.
+     *
+     * REQUIREMENTS: 
+     *   - The polygons are given counter-clockwise 
+     *   - a_i >= 0
+     *
+     * @param offsets the offsets of the polygons in [a] and [b],
+     * followed by the total number of vertices.
+     * @param a the a-value of polygon vertices
+     * @param b the b-value of polygon vertices
+     * @param measures (returns) the measure of each polygon
+     * @param nbThreads the number of threads (0 for all the available threads).
+     */
+    void computeMeasures(const std::vector<unsigned int> &offsets,
+                         const std::vector<double> &a,const std::vector<double> &b,
+                         std::vector<double> &measures,
+                         unsigned int nbThreads = 1) const;
+
+    /**
+     * Compute the measures and the abscissae of the centroids of a
+     * set of polygons given as a packed polygon soup (see
+     * computeMeasures). Same values as computeMeasure and
+     * computeCentroidA on each polygon, up to rounding errors.
+     *
+     * @param offsets the offsets of the polygons in [a] and [b],
+     * followed by the total number of vertices.
+     * @param a the a-value of polygon vertices
+     * @param b the b-value of polygon vertices
+     * @param measures (returns) the measure of each polygon
+     * @param centroidsA (returns) the abscissa of the centroid of each polygon
+     * @param nbThreads the number of threads (0 for all the available threads).
+     */
+    void computeCentroidsA(const std::vector<unsigned int> &offsets,
+                           const std::vector<double> &a,const std::vector<double> &b,
+                           std::vector<double> &measures,
+                           std::vector<double> &centroidsA,
+                           unsigned int nbThreads = 1) const;
+
 
     /**
      * Set the internal Epsilon threshold for the numerical
@@ -170,6 +219,9 @@ namespace DGtal
   private:
     double myEpsilon;
 
+    /// Number of vertices processed together in batch evaluations.
+    static const unsigned int BlockSize = 256;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
@@ -271,6 +323,56 @@ namespace DGtal
      * @return the sign of a number (1 or -1)
      **/
     int sign ( const double a );
+
+    /**
+     * Same as computeMeasureEdge, with only one test (which the
+     * compiler may turn into a select), from the square roots of
+     * 1 + a0^2 and 1 + a1^2.
+     *
+     * @param a0 abscissa first point.
+     * @param s0 sqrt(1 + a0^2).
+     * @param a1 abscissa of the second point.
+     * @param s1 sqrt(1 + a1^2).
+     * @param delta a0*b1 - a1*b0.
+     * @return the measure
+     */
+    static double computeMeasureEdgeTerm ( double a0, double s0,
+                                           double a1, double s1, double delta );
+
+    /**
+     * Same as computeCentroidEdge_a, with only two tests (which the
+     * compiler may turn into selects), from the square root of
+     * 1 + a1^2 and the values of asinh(a)/a (1 in 0).
+     *
+     * @param a0 abscissa first point.
+     * @param h0 asinh(a0)/a0.
+     * @param a1 abscissa of the second point.
+     * @param s1 sqrt(1 + a1^2).
+     * @param h1 asinh(a1)/a1.
+     * @param delta a0*b1 - a1*b0.
+     * @return the measure
+     */
+    static double computeCentroidEdgeTerm_a ( double a0, double h0,
+                                              double a1, double s1, double h1,
+                                              double delta );
+
+    /**
+     * Batch evaluation of computeMeasures and computeCentroidsA, by
+     * blocks of consecutive polygons with about BlockSize vertices.
+     *
+     * @param offsets the offsets of the polygons in [a] and [b],
+     * followed by the total number of vertices.
+     * @param a the a-value of polygon vertices
+     * @param b the b-value of polygon vertices
+     * @param measures (returns) the measure of each polygon
+     * @param centroidsA (returns) if not 0, the abscissa of the centroid of each polygon
+     * @param nbThreads the number of threads (0 for all the available threads).
+     */
+    void computeBatch(const std::vector<unsigned int> &offsets,
+                      const std::vector<double> &a,const std::vector<double> &b,
+                      std::vector<double> &measures,
+                      std::vector<double> *centroidsA,
+                      unsigned int nbThreads) const;
      
 
 
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <complex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CowPtr.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -48,6 +50,18 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+       In-place iterative radix-2 fast Fourier transform.
+
+       @param a the sequence to transform, whose size is a power of 2.
+       @param inverse when 'true', computes the unnormalized inverse
+       transform (ie. n times the inverse transform).
+    */
+    void fft( std::vector< std::complex<double> > & a, bool inverse );
+  } // namespace detail
+
   /**
      Represents the signal data.
 
@@ -319,6 +333,9 @@ namespace DGtal
     /** 
         Convolution product of two signals (F = this).
         F*G( a ) = sum F(a-i)G(i) 
+
+        It is computed by fftConvolution for large kernels G, when
+        isFFTConvolutionFaster, and by directConvolution otherwise.
         
         @param G the second signal (not periodic)
         
@@ -327,6 +344,47 @@ namespace DGtal
     */
     Signal<TValue> operator*( const Signal<TValue>& G );
 
+    /** 
+        Convolution product of two signals (F = this), computed
+        directly in O(nm), n and m being the sizes of F and G.
+        
+        @param G the second signal (not periodic)
+        
+        @return the same signal as operator*.
+    */
+    Signal<TValue> directConvolution( const Signal<TValue>& G ) const;
+
+    /** 
+        Convolution product of two signals (F = this), computed by
+        fast Fourier transform in O(N log N), N being the power of 2
+        greater than the size of the linear convolution (n + m - 1
+        when F is not periodic, 2n - 1 otherwise). The default value
+        of a non periodic F is taken into account as in
+        operator*. Computations are made with doubles.
+
+        TValue must be able to represent real values.
+        
+        @param G the second signal (not periodic)
+        
+        @return the same signal as operator*, up to rounding errors.
+    */
+    Signal<TValue> fftConvolution( const Signal<TValue>& G ) const;
+
+    /**
+       Crossover between directConvolution and fftConvolution (see
+       testSignal-benchmark.cpp), used by operator*.
+
+       @param n the size of the first signal F.
+       @param m the size of the second signal G.
+       @param periodic 'true' if F is periodic.
+
+       @return 'true' if TValue is a floating-point type and
+       fftConvolution is expected to be faster than
+       directConvolution for these sizes.
+    */
+    static bool isFFTConvolutionFaster( unsigned int n, unsigned int m, 
+                                        bool periodic );
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -353,6 +411,15 @@ namespace DGtal
       
     // ------------------------- Hidden services ----------------------------
   protected:
+
+    /** 
+        @param n any positive integer.
+        @param factor the factor applied at each row of Pascal's triangle.
+        @return the binomial signal of order 2n, multiplied by
+        factor^(2n), computed in place.
+    */
+    static Signal<TValue> binomialSignal( unsigned int n, 
+                                          const TValue & factor );
     
 
   }; // end of class Signal
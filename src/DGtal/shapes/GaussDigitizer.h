@@ -198,6 +198,21 @@ namespace DGtal
       return myEShape->orientation(embed(p));
     }
 
+    /**
+     * Orientation of the digital points of the box [aLow,anUp], for
+     * the shapes whose orientation may be computed over a whole
+     * Euclidean box (e.g. ImplicitBall, ImplicitRoundedHyperCube or
+     * ImplicitPolynomial3Shape), i.e. which have a method
+     * orientation( const RealPoint &, const RealPoint & ).
+     *
+     * @param aLow the lowest digital point of the box.
+     * @param anUp the highest digital point of the box.
+     *
+     * @return INSIDE (resp. OUTSIDE) if all the points of the box are
+     * inside (resp. outside) the shape, ON if it is not known.
+     */
+    Orientation orientation( const Point & aLow, const Point & anUp ) const;
+
     /**
      * @param p any point in the digital plane.
      *
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/domains/CDomain.h"
@@ -124,6 +125,105 @@ namespace DGtal
                                  const TShapeFunctor & aFunctor,
                                  const double h = 1.0);
     
+    /**
+     * Same as digitalShaper, but the bounding box of the shape is
+     * scanned row by row (along the first axis). When DGtal is built
+     * with OpenMP (WITH_OPENMP), the rows are processed in parallel:
+     * the orientation() method of [aFunctor] must then be
+     * thread-safe. The inside points of each row are found as
+     * intervals, then the points of each row are inserted at once,
+     * in the order of the domain.
+     *
+     * @param aSet the set (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     * @tparam TDigitalSet a model of CDigitalSet.
+     * @tparam TShapeFunctor a model of CDigitalBoundedShape and
+     * CDigitalOrientedShape.
+     */
+    template <typename TDigitalSet, typename TShapeFunctor>
+    static void parallelDigitalShaper( TDigitalSet & aSet,
+                                       const TShapeFunctor & aFunctor );
+
+    /**
+     * Same as euclideanShaper, but with parallelDigitalShaper.
+     *
+     * @param aSet the set (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     * @param h grid step for the Gauss digitization.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet.
+     * @tparam TShapeFunctor a model of CEuclideanBoundedShape and
+     * CEuclideanOrientedShape.
+     */
+    template <typename TDigitalSet, typename TShapeFunctor>
+    static void parallelEuclideanShaper( TDigitalSet & aSet,
+                                         const TShapeFunctor & aFunctor,
+                                         const double h = 1.0 );
+
+    /**
+     * Same as parallelDigitalShaper, but sets the value of the inside
+     * points of the shape to [aValue] in the image [anImage], whose
+     * domain must contain the bounding box of the shape.
+     *
+     * @param anImage the image (modified).
+     * @param aFunctor a functor defining the shape.
+     * @param aValue the value of the inside points.
+     * @tparam TImage a model of CImage.
+     * @tparam TShapeFunctor a model of CDigitalBoundedShape and
+     * CDigitalOrientedShape.
+     */
+    template <typename TImage, typename TShapeFunctor>
+    static void parallelDigitalShaperInImage( TImage & anImage,
+                                              const TShapeFunctor & aFunctor,
+                                              const typename TImage::Value & aValue );
+
+    /**
+     * Same as digitalShaper, but the bounding box of the shape is
+     * recursively halved along its longest side. The functor must
+     * also provide the orientation of the whole box [aLow,anUp] with
+     * a method orientation( const Point & aLow, const Point & anUp ),
+     * returning INSIDE (resp. OUTSIDE) when all its points are inside
+     * (resp. outside) the shape and ON when it is not known (see
+     * GaussDigitizer). The boxes inside the shape are filled and
+     * those outside are skipped, without evaluating their points,
+     * so that only the points of the boxes that cross the boundary
+     * are evaluated: for a smooth shape of diameter n, the number of
+     * evaluations is then roughly proportional to its boundary,
+     * i.e. to n^(d-1) instead of n^d.
+     *
+     * @param aSet the set (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     * @param aLeafSize the boxes whose longest side has at most
+     * [aLeafSize] points are no longer split and their points are
+     * evaluated one by one.
+     * @tparam TDigitalSet a model of CDigitalSet.
+     * @tparam TShapeFunctor a model of CDigitalBoundedShape and
+     * CDigitalOrientedShape.
+     */
+    template <typename TDigitalSet, typename TShapeFunctor>
+    static void hierarchicalDigitalShaper( TDigitalSet & aSet,
+                                           const TShapeFunctor & aFunctor,
+                                           const Integer aLeafSize = 4 );
+
+    /**
+     * Same as euclideanShaper, but with hierarchicalDigitalShaper:
+     * the shape must provide the orientation of a whole Euclidean box,
+     * as ImplicitBall, ImplicitHyperCube, ImplicitRoundedHyperCube or
+     * ImplicitPolynomial3Shape.
+     *
+     * @param aSet the set (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     * @param h grid step for the Gauss digitization.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet.
+     * @tparam TShapeFunctor a model of CEuclideanBoundedShape and
+     * CEuclideanOrientedShape.
+     */
+    template <typename TDigitalSet, typename TShapeFunctor>
+    static void hierarchicalEuclideanShaper( TDigitalSet & aSet,
+                                             const TShapeFunctor & aFunctor,
+                                             const double h = 1.0 );
+
     /**
      * Adds the discrete ball (norm-1) of center [aCenter] and radius
      * [aRadius] to the (perhaps non empty) set [aSet].
@@ -183,6 +283,37 @@ namespace DGtal
                                  UnsignedInteger aRadius );
 
 
+    // ----------------------- Internals -------------------------------------
+  private:
+
+    /**
+     * Computes the intervals of inside points of each row (along the
+     * first axis) of the box [aLow,anUp], in parallel if DGtal is
+     * built with OpenMP. The rows are numbered in the order of the
+     * domain, and [someRuns][ r ] contains the first and last
+     * abscissae of each interval of the r-th row.
+     */
+    template <typename TShapeFunctor>
+    static void insideRuns( const TShapeFunctor & aFunctor,
+                            const Point & aLow, const Point & anUp,
+                            std::vector< std::vector<Integer> > & someRuns );
+
+    /**
+     * Adds to [aSet] the inside points of the box [aLow,anUp], which
+     * is filled, skipped or split in two (see hierarchicalDigitalShaper).
+     */
+    template <typename TDigitalSet, typename TShapeFunctor>
+    static void hierarchicalFill( TDigitalSet & aSet,
+                                  const TShapeFunctor & aFunctor,
+                                  const Point & aLow, const Point & anUp,
+                                  const Integer aLeafSize );
+
+    /**
+     * @return the first point of the r-th row of the box [aLow,anUp].
+     */
+    static Point rowStart( const Point & aLow, const Point & anUp,
+                           std::size_t r );
+
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
@@ -116,6 +118,39 @@ namespace DGtal
           return ON;
     }
 
+    /**
+     * Orientation of a whole box, from the nearest and farthest
+     * points of the box to the center.
+     *
+     * @param aLow the lowest point of the box.
+     * @param anUp the highest point of the box.
+     * @return INSIDE (resp. OUTSIDE) if every point of the box is
+     * inside (resp. outside) the ball, ON if the box may intersect
+     * its boundary.
+     */
+    inline
+    Orientation orientation(const RealPoint &aLow, const RealPoint &anUp) const
+    {
+      double dmin = 0.0, dmax = 0.0;
+      for(Dimension i = 0; i < RealPoint::dimension; ++i)
+        {
+          double l = (double)aLow[i] - (double)myCenter[i];
+          double u = (double)anUp[i] - (double)myCenter[i];
+          double dnear = (l > 0.0) ? l : ( (u < 0.0) ? -u : 0.0 );
+          double dfar = std::max( std::abs(l), std::abs(u) );
+          dmin += dnear * dnear;
+          dmax += dfar * dfar;
+        }
+      double r = NumberTraits<Integer>::castToDouble((const DGtal::int32_t)myRadius);
+      if (r - std::sqrt(dmax) > 0.0)
+        return INSIDE;
+      else
+        if (r - std::sqrt(dmin) < 0.0)
+          return OUTSIDE;
+        else
+          return ON;
+    }
+
     inline
     RealPoint getLowerBound() const
     {
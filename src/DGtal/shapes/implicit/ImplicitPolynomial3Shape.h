@@ -46,6 +46,7 @@
 #include "DGtal/base/CPredicate.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/MPolynomialProgram.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +61,9 @@ namespace DGtal
    *
    * Model of CImplicitFunction
    *
+   * The polynomial is compiled into a MPolynomialProgram, so that
+   * the evaluations of its value and gradient do not allocate memory.
+   *
    * @tparam TSpace the Digital space definition.
    */
   
@@ -75,6 +79,7 @@ namespace DGtal
     typedef typename RealPoint::Coordinate Ring;
     typedef typename Space::Integer Integer;
     typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef MPolynomialProgram< 3, Ring > Program3;
     typedef Ring Value;
     
     BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
@@ -130,6 +135,22 @@ namespace DGtal
     */
     Orientation orientation(const RealPoint &aPoint) const;
 
+    /**
+       Orientation of a whole box, from the bounds of the polynomial
+       over the box given by MPolynomialProgram::evalInterval. They
+       are rounded outward, so that a box is INSIDE (resp. OUTSIDE)
+       only if orientation gives INSIDE (resp. OUTSIDE) at each of its
+       points.
+
+       @param aLow the lowest point of the box.
+       @param anUp the highest point of the box.
+
+       @return INSIDE (resp. OUTSIDE) if the polynomial is > 0 (resp.
+       < 0) over the box, ON if the box may intersect the zero-level
+       set.
+    */
+    Orientation orientation(const RealPoint &aLow, const RealPoint &anUp) const;
+
     /**
        @param aPoint any point in the Euclidean space.
        @return the gradient vector of the polynomial at \a aPoint.
@@ -158,8 +179,8 @@ namespace DGtal
   private:
     /// The 3-polynomial defining the implicit shape.
     Polynomial3 myPolynomial;
-    /// The gradient 3-polynomials (computed).
-    Polynomial3 myDerivatives[ 3 ];
+    /// The compiled 3-polynomial, for its value and gradient.
+    Program3 myProgram;
    
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -143,6 +145,40 @@ namespace DGtal
           return ON;
     }
 
+    /** 
+     * Orientation of a whole box: the function is decreasing with
+     * the distance to the center along each axis, and is thus
+     * bounded by its values at the nearest and farthest points of
+     * the box.
+     * 
+     * @param aLow the lowest point of the box.
+     * @param anUp the highest point of the box.
+     * @return INSIDE (resp. OUTSIDE) if every point of the box is
+     * inside (resp. outside) the shape, ON if the box may intersect
+     * its boundary.
+     */
+    inline
+    Orientation orientation(const RealPoint &aLow, const RealPoint &anUp) const
+    {
+      double pmin = 0.0, pmax = 0.0;
+      for(Dimension i = 0; i < RealPoint::dimension; ++i)
+        {
+          double l = (double)aLow[i] - (double)myCenter[i];
+          double u = (double)anUp[i] - (double)myCenter[i];
+          double dnear = (l > 0.0) ? l : ( (u < 0.0) ? -u : 0.0 );
+          pmin += std::pow( dnear, myPower );
+          pmax += std::pow( std::max( std::abs(l), std::abs(u) ), myPower );
+        }
+      double w = std::pow(myHalfWidth, myPower);
+      if (w - pmax > 0.0)
+        return INSIDE;
+      else
+        if (w - pmin < 0.0)
+          return OUTSIDE;
+        else
+          return ON;
+    }
+
 
     /** 
      * Returns the lower bound of the Shape bounding box.
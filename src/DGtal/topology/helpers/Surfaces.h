@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/topology/SurfelAdjacency.h"
@@ -55,6 +56,45 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Point predicate reading a dense bitmap of the values of another
+     * point predicate on a box, and calling it outside the box.
+     *
+     * @tparam TPointPredicate a model of CPointPredicate
+     */
+    template <typename TPointPredicate>
+    struct SpelBitmapPredicate
+    {
+      typedef typename TPointPredicate::Point Point;
+
+      SpelBitmapPredicate( const TPointPredicate & aPredicate,
+                           const std::vector<char> & aBitmap,
+                           const Point & aLowerBound,
+                           const Point & aUpperBound )
+        : myPredicate( &aPredicate ), myBitmap( &aBitmap ),
+          myLowerBound( aLowerBound ), myUpperBound( aUpperBound )
+      {}
+
+      bool operator()( const Point & p ) const
+      {
+        if ( ( p[ 0 ] < myLowerBound[ 0 ] ) || ( p[ 0 ] > myUpperBound[ 0 ] )
+             || ( p[ 1 ] < myLowerBound[ 1 ] ) || ( p[ 1 ] > myUpperBound[ 1 ] ) )
+          return ( *myPredicate )( p );
+        const std::size_t width =
+          static_cast<std::size_t>( myUpperBound[ 0 ] - myLowerBound[ 0 ] + 1 );
+        return ( *myBitmap )[ static_cast<std::size_t>( p[ 1 ] - myLowerBound[ 1 ] ) * width
+                              + static_cast<std::size_t>( p[ 0 ] - myLowerBound[ 0 ] ) ] != 0;
+      }
+
+      const TPointPredicate * myPredicate;
+      const std::vector<char> * myBitmap;
+      Point myLowerBound;
+      Point myUpperBound;
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class Surfaces
   /**
@@ -413,6 +453,96 @@ namespace DGtal
       const KSpace & aKSpace,
       const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
       const PointPredicate & pp );
+
+
+    /**
+       Extract, like extractAll2DSCellContours, all the contours of a
+       2D digital shape as vectors of signed surfels, but in a single
+       raster scan of the bounds of the space.
+
+       The predicate [pp] is first evaluated once at each point of the
+       bounds of [aKSpace] and the results are stored in a dense
+       bitmap, row by row in parallel when DGtal is built with OpenMP
+       (WITH_OPENMP): [pp] must then be thread-safe. The rows are then
+       scanned and each boundary surfel that has not been visited yet
+       starts the tracking of a new contour, on the bitmap. The visited
+       surfels are marked in a dense bitmap instead of being erased
+       from a set of surfels.
+
+       The contours are the same as the ones of
+       extractAll2DSCellContours, but not in the same order: the
+       surfels orthogonal to the first axis are scanned first, then
+       the ones orthogonal to the second axis, each row by row, and the
+       contours are given in the order of their first scanned surfel.
+       extractAll2DSCellContours follows instead the order of a
+       std::set of surfels, so that the order of the contours and their
+       starting surfels generally differ.
+       
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+       
+       @param aVectSCellContour2D (modified) a vector of contours
+       represented by vectors of signed surfels.
+       
+       @param aKSpace any space of dimension 2.
+       
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+    */
+    template <typename PointPredicate>
+    static 
+    void scanAll2DSCellContours
+    ( std::vector< std::vector<SCell> > & aVectSCellContour2D,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp );
+
+    /**
+       Extract, like extractAllPointContours4C, all 4-connected
+       contours as vectors of points, but from the contours of surfels
+       given by scanAll2DSCellContours, hence in its order.
+       
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+       
+       @param aVectPointContour2D (modified) a vector of contours
+       represented by vectors of points.
+       
+       @param aKSpace any space of dimension 2.
+
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aSAdj the surfel adjacency chosen for the tracking.
+    */
+    template <typename PointPredicate>
+    static 
+    void scanAllPointContours4C
+    ( std::vector< std::vector< Point > > & aVectPointContour2D,
+      const KSpace & aKSpace,
+      const PointPredicate & pp,
+      const SurfelAdjacency<2> &aSAdj );
+
+    /**
+       Computes the sequence of points defined by the sequence of
+       pointels of a contour of surfels, as in extractAllPointContours4C.
+
+       @param aPointContour2D (returned) the sequence of points.
+
+       @param aKSpace any space of dimension 2.
+
+       @param aSCellContour2D a contour of surfels, like the ones
+       given by track2DBoundary.
+    */
+    static 
+    void pointContour4C
+    ( std::vector< Point > & aPointContour2D,
+      const KSpace & aKSpace,
+      const std::vector<SCell> & aSCellContour2D );
     
 
     /**
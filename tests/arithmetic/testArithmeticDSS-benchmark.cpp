@@ -30,13 +30,16 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
 #include "DGtal/arithmetic/SternBrocot.h"
 #include "DGtal/arithmetic/Pattern.h"
 #include "DGtal/arithmetic/StandardDSLQ0.h"
 #include "DGtal/geometry/curves/representation/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/representation/AdaptiveArithmeticalDSS.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -150,6 +153,101 @@ bool testSubStandardDSLQ0( unsigned int nbtries,
   return true;
 }
 
+/**
+ * Recognizes the subsegment [A,B] of [D] with the segment computer
+ * [DSS] and writes its parameters in [a], [b], [mu].
+ */
+template <typename DSS, typename DSL>
+void recognizeSubSegment( const DSL & D,
+                          const typename DSL::Point & A,
+                          const typename DSL::Point & B,
+                          BigInteger & a, BigInteger & b, BigInteger & mu )
+{
+  typedef typename DSL::ConstIterator ConstIterator;
+  ConstIterator it = D.begin( A );
+  ConstIterator it_end = D.end( B );
+  DSS dss;
+  dss.init( it );
+  while ( ( dss.end() != it_end )
+          && ( dss.extendForward() ) ) {}
+  a = dss.getA();
+  b = dss.getB();
+  mu = dss.getMu();
+}
+
+/**
+ * Times the recognition of the same random subsegments of
+ * StandardDSLQ0 with ArithmeticalDSS on BigInteger, with
+ * AdaptiveArithmeticalDSS on BigInteger and with ArithmeticalDSS on
+ * DGtal::int64_t, and checks that they have the same parameters.
+ * The abscissas of the subsegments are shifted by [offset], which
+ * makes AdaptiveArithmeticalDSS use BigInteger if greater than
+ * its safe bound.
+ */
+template <typename Fraction>
+bool benchmarkAdaptiveDSS( unsigned int nbtries,
+                           typename Fraction::Integer moda,
+                           typename Fraction::Integer modb,
+                           typename Fraction::Integer modx,
+                           typename Fraction::Integer offset )
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename Fraction::Integer Integer;
+  typedef typename DSL::Point Point;
+  typedef typename DSL::ConstIterator ConstIterator;
+  typedef ArithmeticalDSS<ConstIterator, BigInteger, 4> ExactDSS;
+  typedef AdaptiveArithmeticalDSS<ConstIterator, BigInteger, 4> AdaptiveDSS;
+  typedef ArithmeticalDSS<ConstIterator, DGtal::int64_t, 4> FastDSS;
+  IntegerComputer<Integer> ic;
+
+  std::vector<DSL> lines;
+  std::vector<Point> firstPoints, lastPoints;
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      Integer a( random() % moda + 1 );
+      Integer b( random() % modb + 1 );
+      if ( ic.gcd( a, b ) == 1 )
+        {
+          DSL D( a, b, random() % (moda+modb) );
+          for ( Integer x = 0; x < 10; ++x )
+            {
+              Integer x1 = offset + random() % modx;
+              Integer x2 = x1 + 1 + ( random() % modx );
+              lines.push_back( D );
+              firstPoints.push_back( D.lowestY( x1 ) );
+              lastPoints.push_back( D.lowestY( x2 ) );
+            }
+        }
+    }
+  const unsigned int n = lines.size();
+  std::vector<BigInteger> params1( 3 * n ), params2( 3 * n ), params3( 3 * n );
+
+  Clock c;
+  c.startClock();
+  for ( unsigned int i = 0; i < n; ++i )
+    recognizeSubSegment<ExactDSS>( lines[ i ], firstPoints[ i ], lastPoints[ i ],
+                                   params1[ 3*i ], params1[ 3*i+1 ], params1[ 3*i+2 ] );
+  double t1 = c.stopClock();
+  c.startClock();
+  for ( unsigned int i = 0; i < n; ++i )
+    recognizeSubSegment<AdaptiveDSS>( lines[ i ], firstPoints[ i ], lastPoints[ i ],
+                                      params2[ 3*i ], params2[ 3*i+1 ], params2[ 3*i+2 ] );
+  double t2 = c.stopClock();
+  c.startClock();
+  for ( unsigned int i = 0; i < n; ++i )
+    recognizeSubSegment<FastDSS>( lines[ i ], firstPoints[ i ], lastPoints[ i ],
+                                  params3[ 3*i ], params3[ 3*i+1 ], params3[ 3*i+2 ] );
+  double t3 = c.stopClock();
+
+  bool ok = ( params1 == params2 ) && ( params1 == params3 );
+  std::cout << "# " << n << " subsegments, offset " << offset
+            << ", BigInteger: " << t1 << " ms"
+            << ", adaptive: " << t2 << " ms"
+            << ", int64: " << t3 << " ms"
+            << ( ok ? ", same parameters" : ", different parameters" )
+            << std::endl;
+  return ok;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -164,7 +262,11 @@ int main( int argc, char** argv)
   Integer modb = ( argc > 3 ) ? atoll( argv[ 3 ] ) : 12000;
   Integer modx = ( argc > 4 ) ? atoll( argv[ 4 ] ) : 1000;
   testSubStandardDSLQ0<Fraction>( nbtries, moda, modb, modx );
-  return true;
+  //same subsegments near the origin and far from it
+  bool res = benchmarkAdaptiveDSS<Fraction>( nbtries, moda, modb, modx, 0 )
+    && benchmarkAdaptiveDSS<Fraction>( nbtries, moda, modb, modx,
+                                       ( (Integer) 1 ) << 40 );
+  return res ? 0 : 1;
 }
 
 //                                                                           //
@@ -0,0 +1,360 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testInlineSternBrocot.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/07/02
+ *
+ * Functions for testing class InlineSternBrocot.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/arithmetic/CPositiveIrreducibleFraction.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/InlineSternBrocot.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+#include "DGtal/geometry/curves/representation/ArithmeticalDSS.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class InlineSternBrocot.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename F1, typename F2>
+bool
+sameFraction( const F1 & f1, const F2 & f2 )
+{
+  if ( f1.null() || f2.null() )
+    return f1.null() && f2.null();
+  // 1/0 has quotient 1 as in LighterSternBrocot, 0 in SternBrocot.
+  return ( f1.p() == f2.p() ) && ( f1.q() == f2.q() )
+    && ( f1.k() == f2.k() ) && ( ( f1.k() < 0 ) || ( f1.u() == f2.u() ) );
+}
+
+/**
+ * Compares the navigation from p/q with the one of SternBrocot.
+ */
+template <typename SB, typename LSB>
+bool testSameNavigation( typename SB::Integer p, typename SB::Integer q )
+{
+  typedef typename SB::Quotient Quotient;
+  typedef typename SB::Fraction Fraction;
+  typedef typename LSB::Fraction LFraction;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Fraction f = SB::fraction( p, q );
+  LFraction lf = LSB::fraction( p, q );
+  ++nb, nbok += sameFraction( f, lf ) ? 1 : 0;
+  ++nb, nbok += sameFraction( f.left(), lf.left() ) ? 1 : 0;
+  ++nb, nbok += sameFraction( f.right(), lf.right() ) ? 1 : 0;
+  ++nb, nbok += sameFraction( f.father(), lf.father() ) ? 1 : 0;
+  ++nb, nbok += sameFraction( f.previousPartial(), lf.previousPartial() ) ? 1 : 0;
+  ++nb, nbok += sameFraction( f.inverse(), lf.inverse() ) ? 1 : 0;
+  ++nb, nbok += sameFraction( f.inverse().inverse(), f ) ? 1 : 0;
+  for ( Quotient i = 0; i <= f.k() + 2; ++i )
+    ++nb, nbok += sameFraction( f.reduced( i ), lf.reduced( i ) ) ? 1 : 0;
+  for ( Quotient m = 0; m < f.u(); ++m )
+    ++nb, nbok += sameFraction( f.father( m ), lf.father( m ) ) ? 1 : 0;
+  Fraction f1, f2;
+  LFraction lf1, lf2;
+  Quotient nb1, nb2, lnb1, lnb2;
+  f.getSplit( f1, f2 );
+  lf.getSplit( lf1, lf2 );
+  ++nb, nbok += ( sameFraction( f1, lf1 ) && sameFraction( f2, lf2 ) ) ? 1 : 0;
+  f.getSplitBerstel( f1, nb1, f2, nb2 );
+  lf.getSplitBerstel( lf1, lnb1, lf2, lnb2 );
+  ++nb, nbok += ( sameFraction( f1, lf1 ) && sameFraction( f2, lf2 )
+                  && ( nb1 == lnb1 ) && ( nb2 == lnb2 ) ) ? 1 : 0;
+  std::vector<Quotient> cf, lcf;
+  f.getCFrac( cf );
+  lf.getCFrac( lcf );
+  ++nb, nbok += ( cf == lcf ) ? 1 : 0;
+  if ( nbok != nb )
+    {
+      trace.info() << "(" << nbok << "/" << nb << ") f=";
+      SB::display( trace.info(), f );
+      trace.info() << std::endl;
+    }
+  return nbok == nb;
+}
+
+template <typename SB>
+bool testNavigation()
+{
+  typedef typename SB::Integer Integer;
+  typedef SternBrocot<Integer, typename SB::Quotient> LSB;
+  IntegerComputer<Integer> ic;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: same navigation as SternBrocot." );
+  ++nb, nbok += testSameNavigation<SB,LSB>( 1, 1 ) ? 1 : 0;
+  ++nb, nbok += testSameNavigation<SB,LSB>( 1, 2 ) ? 1 : 0;
+  ++nb, nbok += testSameNavigation<SB,LSB>( 2, 1 ) ? 1 : 0;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    {
+      Integer p = random() % 100000 + 1;
+      Integer q = random() % 100000 + 1;
+      Integer g = ic.gcd( p, q );
+      ++nb, nbok += testSameNavigation<SB,LSB>( p / g, q / g ) ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") fractions." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * The deepest fraction of 64-bits integers is a ratio of two
+ * consecutive Fibonacci numbers.
+ */
+template <typename SB>
+bool testDeepFraction()
+{
+  typedef typename SB::Integer Integer;
+  typedef typename SB::Quotient Quotient;
+  typedef typename SB::Fraction Fraction;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: deepest 64-bits fraction." );
+  Integer f0 = 1, f1 = 1;
+  for ( unsigned int i = 0; i < 90; ++i )
+    {
+      Integer f2 = f0 + f1;
+      f0 = f1;
+      f1 = f2;
+    }
+  Fraction f = SB::fraction( f1, f0 );
+  trace.info() << "f=" << f1 << "/" << f0 << " k=" << f.k() << std::endl;
+  ++nb, nbok += ( ( f.p() == f1 ) && ( f.q() == f0 ) ) ? 1 : 0;
+  ++nb, nbok += ( f.k() == 89 ) && ( f.u() == 2 ) ? 1 : 0;
+  // [1,1,...,1,2] => [1,1,...,1] = [1,1,...,2]
+  for ( Quotient i = 1; i <= f.k(); ++i )
+    {
+      Fraction g = f.reduced( i );
+      ++nb, nbok += ( g == SB::fraction( g.p(), g.q() ) )
+        && ( g.k() == SB::fraction( g.p(), g.q() ).k() ) ? 1 : 0;
+    }
+  Fraction g = f.inverse();
+  ++nb, nbok += ( ( g.p() == f0 ) && ( g.q() == f1 ) && ( g.k() == 90 ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") checks." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * A fraction deeper than the capacity is rejected by an exception.
+ */
+bool testCapacity()
+{
+  typedef InlineSternBrocot< DGtal::int64_t, DGtal::int32_t, 16 > SB;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: capacity." );
+  DGtal::int64_t f0 = 1, f1 = 1;
+  for ( unsigned int i = 0; i < 15; ++i )
+    {
+      DGtal::int64_t f2 = f0 + f1;
+      f0 = f1;
+      f1 = f2;
+    }
+  // the inverse of a fraction of 15 quotients has 16 of them, the
+  // one of the next ratio of Fibonacci numbers would have 17.
+  SB::Fraction f = SB::fraction( f1, f0 );
+  ++nb, nbok += ( f.k() == 14 ) && ( f.inverse().k() == 15 ) ? 1 : 0;
+  bool hasThrown = false;
+  try 
+    {
+      SB::fraction( f0 + f1, f1 ).inverse();
+    }
+  catch ( DGtal::MemoryException & )
+    {
+      hasThrown = true;
+    }
+  ++nb, nbok += hasThrown ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") checks." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+template <typename Quotient>
+bool
+equalCFrac( const std::vector<Quotient> & c1, const std::vector<Quotient> & c2 )
+{
+  unsigned int s = c1.size() < c2.size() ? c1.size() : c2.size();
+  if ( ( s != c1.size() ) && ( c1.back() != NumberTraits<Quotient>::ONE ) )
+    return false;
+  if ( ( s != c2.size() ) && ( c2.back() != NumberTraits<Quotient>::ONE ) )
+    return false;
+  for ( unsigned int i = 0; i < s; ++i )
+    {
+      Quotient q1 = c1[ i ];
+      if ( ( s != c1.size() ) && ( i == s - 1 ) ) q1 += c1.back();
+      Quotient q2 = c2[ i ];
+      if ( ( s != c2.size() ) && ( i == s - 1 ) ) q2 += c2.back();
+      if ( q1 != q2 ) return false;
+    }
+  return true;
+}
+
+template <typename SB>
+bool testContinuedFraction()
+{
+  typedef typename SB::Quotient Quotient;
+  typedef typename SB::Fraction Fraction;
+  typedef typename SB::Fraction::ConstIterator ConstIterator;
+
+  Fraction f;
+  std::vector<Quotient> quotients;
+  std::vector<Quotient> qcfrac;
+  std::back_insert_iterator< Fraction > itout =
+    std::back_inserter( f );
+  unsigned int size = ( random() % 20 ) + 10;
+  for ( unsigned int i = 0; i < size; ++i )
+    {
+      Quotient q = ( i == 0 )
+        ? ( random() % 5 )
+        : ( random() % 5 ) + 1;
+      *itout++ = std::make_pair( q, (Quotient) i );
+      quotients.push_back( q );
+    }
+  for ( ConstIterator it = f.begin(), it_end = f.end();
+        it != it_end; ++it )
+    qcfrac.push_back( (*it).first );
+  return equalCFrac( quotients, qcfrac );
+}
+
+template <typename SB>
+bool testContinuedFractions()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: continued fractions." );
+  for ( unsigned int i = 0; i < 1000; ++i )
+    ++nb, nbok += testContinuedFraction<SB>() ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ")"
+               << " continued fractions." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+template <typename DSL>
+bool checkSubStandardDSLQ0( const DSL & D,
+                            const typename DSL::Point & A,
+                            const typename DSL::Point & B )
+{
+  typedef typename DSL::Integer Integer;
+  typedef typename DSL::ConstIterator ConstIterator;
+  typedef ArithmeticalDSS<ConstIterator, Integer, 4> ADSS;
+
+  DSL S = D.reversedSmartDSS( A, B );
+  ConstIterator it = D.begin( A );
+  ConstIterator it_end = D.end( B );
+  ADSS dss;
+  dss.init( it );
+  while ( ( dss.end() != it_end )
+          && ( dss.extendForward() ) ) {}
+  bool ok = S.a() == dss.getA()
+    &&  S.b() == dss.getB()
+    &&  S.mu() == dss.getMu();
+  if ( ! ok )
+    {
+      trace.info() << "D = " << D << " " << D.pattern().rE() << endl;
+      trace.info() << "S(" << A << "," << B << ") = "
+                   << S << " " << S.pattern() << endl;
+      trace.info() << "ArithDSS = " << dss << std::endl;
+    }
+  return ok;
+}
+
+template <typename Fraction>
+bool testSubStandardDSLQ0()
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename Fraction::Integer Integer;
+  typedef typename DSL::Point Point;
+  IntegerComputer<Integer> ic;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Check ReversedSmartDSS == ArithmeticDSS" );
+  for ( unsigned int i = 0; i < 100; ++i )
+    {
+      Integer a( random() % 12000 + 1 );
+      Integer b( random() % 12000 + 1 );
+      if ( ic.gcd( a, b ) == 1 )
+        {
+          for ( Integer mu = 0; mu < 5; ++mu )
+            {
+              DSL D( a, b, random() % 10000 );
+              for ( Integer x = 0; x < 10; ++x )
+                {
+                  Integer x1 = random() % 1000;
+                  Integer x2 = x1 + 1 + ( random() % 1000 );
+                  Point A = D.lowestY( x1 );
+                  Point B = D.lowestY( x2 );
+                  ++nb, nbok += checkSubStandardDSLQ0<DSL>( D, A, B ) ? 1 : 0;
+                }
+            }
+        }
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") correct reversedSmartDSS."
+               << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int , char** )
+{
+  typedef InlineSternBrocot< DGtal::int64_t, DGtal::int32_t > SB;
+  typedef SB::Fraction Fraction;
+  typedef Fraction::ConstIterator ConstIterator;
+
+  BOOST_CONCEPT_ASSERT(( CPositiveIrreducibleFraction< Fraction > ));
+  BOOST_CONCEPT_ASSERT(( boost::InputIterator< ConstIterator > ));
+
+  trace.beginBlock ( "Testing class InlineSternBrocot" );
+  bool res = testNavigation<SB>()
+    && testDeepFraction<SB>()
+    && testCapacity()
+    && testContinuedFractions<SB>()
+    && testSubStandardDSLQ0<Fraction>();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
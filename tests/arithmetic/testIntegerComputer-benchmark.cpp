@@ -0,0 +1,216 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIntegerComputer-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/07/05
+ *
+ * Benchmark of the fixed-width fast paths of IntegerComputer against
+ * its generic methods, with int32_t and int64_t.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class IntegerComputer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+   Gives access to the generic methods of IntegerComputer, whatever
+   the integer type.
+*/
+template <typename TInteger>
+struct GenericIntegerComputer : public IntegerComputer<TInteger>
+{
+  typedef IntegerComputer<TInteger> Base;
+  typedef typename Base::Integer Integer;
+  typedef typename Base::Vector2I Vector2I;
+  typedef typename Base::Vector3I Vector3I;
+
+  Integer floorDiv( Integer a, Integer b ) const
+  { return Base::floorDiv( a, b, TagFalse() ); }
+  Integer ceilDiv( Integer a, Integer b ) const
+  { return Base::ceilDiv( a, b, TagFalse() ); }
+  Integer gcd( Integer a, Integer b ) const
+  { return Base::gcd( a, b, TagFalse() ); }
+  Integer crossProduct( const Vector2I & u, const Vector2I & v ) const
+  { return Base::crossProduct( u, v, TagFalse() ); }
+  Vector2I extendedEuclid( Integer a, Integer b, Integer c ) const
+  { return Base::extendedEuclid( a, b, c, TagFalse() ); }
+  void reduce( Vector3I & p ) const
+  { p /= gcd( gcd( p[ 0 ], p[ 1 ] ), p[ 2 ] ); }
+};
+
+/**
+   Times the same operations with the generic methods and the fast
+   paths, on \a n random integers with \a bits bits, and checks that
+   the results are the same.
+*/
+template <typename Integer>
+bool benchmarkIntegerComputer( const std::string & name, 
+                               unsigned int n, unsigned int bits )
+{
+  typedef IntegerComputer<Integer> IC;
+  typedef GenericIntegerComputer<Integer> GIC;
+  typedef typename IC::Vector2I Vector2I;
+  typedef typename IC::Vector3I Vector3I;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Benchmarking " + name );
+  srandom( 0 );
+  const Integer mask = ( Integer( 1 ) << bits ) - 1;
+  std::vector<Integer> a( n ), b( n );
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      a[ i ] = Integer( ( ( Integer( random() ) << 31 ) ^ random() ) & mask );
+      b[ i ] = Integer( ( ( Integer( random() ) << 31 ) ^ random() ) & mask ) + 1;
+      if ( random() % 2 ) a[ i ] = -a[ i ];
+      if ( random() % 2 ) b[ i ] = -b[ i ];
+    }
+  IC ic;
+  GIC gic;
+  Clock c;
+  double t[ 2 ];
+  Integer r[ 2 ];
+
+  // floorDiv and ceilDiv
+  c.startClock(); r[ 0 ] = 0;
+  for ( unsigned int i = 0; i < n; ++i )
+    r[ 0 ] += gic.floorDiv( a[ i ], b[ i ] ) + gic.ceilDiv( b[ i ], a[ i ] | 1 );
+  t[ 0 ] = c.stopClock();
+  c.startClock(); r[ 1 ] = 0;
+  for ( unsigned int i = 0; i < n; ++i )
+    r[ 1 ] += ic.floorDiv( a[ i ], b[ i ] ) + ic.ceilDiv( b[ i ], a[ i ] | 1 );
+  t[ 1 ] = c.stopClock();
+  trace.info() << "floorDiv+ceilDiv: generic " << t[ 0 ] << " ms, fast " 
+               << t[ 1 ] << " ms" << std::endl;
+  ++nb, nbok += ( r[ 0 ] == r[ 1 ] ) ? 1 : 0;
+
+  // gcd
+  c.startClock(); r[ 0 ] = 0;
+  for ( unsigned int i = 0; i < n; ++i )
+    r[ 0 ] += gic.gcd( a[ i ], b[ i ] );
+  t[ 0 ] = c.stopClock();
+  c.startClock(); r[ 1 ] = 0;
+  for ( unsigned int i = 0; i < n; ++i )
+    r[ 1 ] += ic.gcd( a[ i ], b[ i ] );
+  t[ 1 ] = c.stopClock();
+  trace.info() << "gcd: generic " << t[ 0 ] << " ms, fast " 
+               << t[ 1 ] << " ms" << std::endl;
+  ++nb, nbok += ( r[ 0 ] == r[ 1 ] ) ? 1 : 0;
+
+  // extended Euclid
+  c.startClock(); r[ 0 ] = 0;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      Vector2I v = gic.extendedEuclid( a[ i ], b[ i ], 1 );
+      r[ 0 ] += v[ 0 ] ^ v[ 1 ];
+    }
+  t[ 0 ] = c.stopClock();
+  c.startClock(); r[ 1 ] = 0;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      Vector2I v = ic.extendedEuclid( a[ i ], b[ i ], 1 );
+      r[ 1 ] += v[ 0 ] ^ v[ 1 ];
+    }
+  t[ 1 ] = c.stopClock();
+  trace.info() << "extendedEuclid: generic " << t[ 0 ] << " ms, fast " 
+               << t[ 1 ] << " ms" << std::endl;
+  ++nb, nbok += ( r[ 0 ] == r[ 1 ] ) ? 1 : 0;
+
+  // cross product of vectors with half as many bits
+  const unsigned int half = bits / 2;
+  c.startClock(); r[ 0 ] = 0;
+  for ( unsigned int i = 0; i + 1 < n; ++i )
+    r[ 0 ] += gic.crossProduct( Vector2I( a[ i ] >> half, b[ i ] >> half ),
+                                Vector2I( a[ i+1 ] >> half, b[ i+1 ] >> half ) );
+  t[ 0 ] = c.stopClock();
+  c.startClock(); r[ 1 ] = 0;
+  unsigned int nbOverflows = 0;
+  for ( unsigned int i = 0; i + 1 < n; ++i )
+    {
+      Integer cp;
+      if ( ! ic.getCheckedCrossProduct( cp, 
+                                        Vector2I( a[ i ] >> half, b[ i ] >> half ),
+                                        Vector2I( a[ i+1 ] >> half, b[ i+1 ] >> half ) ) )
+        ++nbOverflows;
+      r[ 1 ] += cp;
+    }
+  t[ 1 ] = c.stopClock();
+  trace.info() << "crossProduct: generic " << t[ 0 ] << " ms, fast (checked) " 
+               << t[ 1 ] << " ms" << std::endl;
+  ++nb, nbok += ( r[ 0 ] == r[ 1 ] ) && ( nbOverflows == 0 ) ? 1 : 0;
+
+  // reduce in Z3
+  c.startClock(); r[ 0 ] = 0;
+  for ( unsigned int i = 0; i + 1 < n; ++i )
+    {
+      Vector3I p( a[ i ] * 6, b[ i ] * 6, a[ i+1 ] * 6 );
+      gic.reduce( p );
+      r[ 0 ] += p[ 0 ] ^ p[ 1 ] ^ p[ 2 ];
+    }
+  t[ 0 ] = c.stopClock();
+  c.startClock(); r[ 1 ] = 0;
+  for ( unsigned int i = 0; i + 1 < n; ++i )
+    {
+      Vector3I p( a[ i ] * 6, b[ i ] * 6, a[ i+1 ] * 6 );
+      ic.reduce( p );
+      r[ 1 ] += p[ 0 ] ^ p[ 1 ] ^ p[ 2 ];
+    }
+  t[ 1 ] = c.stopClock();
+  trace.info() << "reduce (Z3): generic " << t[ 0 ] << " ms, fast " 
+               << t[ 1 ] << " ms" << std::endl;
+  ++nb, nbok += ( r[ 0 ] == r[ 1 ] ) ? 1 : 0;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same results" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  unsigned int n = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 4000000;
+  trace.beginBlock ( "Benchmarking class IntegerComputer" );
+  bool res = benchmarkIntegerComputer<DGtal::int32_t>( "int32_t, 28 bits", n, 28 )
+    && benchmarkIntegerComputer<DGtal::int64_t>( "int64_t, 28 bits", n, 28 )
+    && benchmarkIntegerComputer<DGtal::int64_t>( "int64_t, 60 bits", n, 60 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -257,6 +257,100 @@ bool testValidBezout( const IntegerComputer<Integer> & ic )
   return nbok == nb;
 }
 
+/**
+   Checks the fast paths of fixed-width integers against the generic
+   methods of IntegerComputer.
+*/
+template <typename TInteger>
+struct GenericIntegerComputer : public IntegerComputer<TInteger>
+{
+  typedef IntegerComputer<TInteger> Base;
+  typedef typename Base::Integer Integer;
+  typedef typename Base::Vector2I Vector2I;
+
+  Integer floorDiv( Integer a, Integer b ) const
+  { return Base::floorDiv( a, b, TagFalse() ); }
+  Integer ceilDiv( Integer a, Integer b ) const
+  { return Base::ceilDiv( a, b, TagFalse() ); }
+  Integer gcd( Integer a, Integer b ) const
+  { return Base::gcd( a, b, TagFalse() ); }
+  Vector2I extendedEuclid( Integer a, Integer b, Integer c ) const
+  { return Base::extendedEuclid( a, b, c, TagFalse() ); }
+};
+
+template <typename Integer>
+bool testFastPaths( const IntegerComputer<Integer> & ic )
+{
+  typedef typename IntegerComputer<Integer>::Vector2I Vector2I;
+  GenericIntegerComputer<Integer> gic;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  for ( Integer a = -100; a <= 100; ++a )
+    for ( Integer b = -100; b <= 100; ++b )
+      {
+        bool ok = ic.gcd( a, b ) == gic.gcd( a, b );
+        if ( b != 0 )
+          {
+            Integer fl, ce;
+            ic.getFloorCeilDiv( fl, ce, a, b );
+            ok = ok && ( ic.floorDiv( a, b ) == gic.floorDiv( a, b ) )
+              && ( ic.ceilDiv( a, b ) == gic.ceilDiv( a, b ) )
+              && ( fl == gic.floorDiv( a, b ) ) && ( ce == gic.ceilDiv( a, b ) );
+          }
+        if ( ( a != 0 ) && ( b != 0 ) )
+          ok = ok && ( ic.extendedEuclid( a, b, 3 ) 
+                       == gic.extendedEuclid( a, b, 3 ) );
+        nbok += ok ? 1 : 0;
+        nb++;
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same gcd, floor, ceil, Bezout as generic methods." << std::endl;
+  const Integer big = NumberTraits<Integer>::max() / 2;
+  Integer cp;
+  nbok += ic.getCheckedCrossProduct( cp, Vector2I( big, 3 ), Vector2I( 2, 1 ) )
+    && ( cp == big - 6 ) ? 1 : 0;
+  nb++;
+  nbok += ! ic.getCheckedCrossProduct( cp, Vector2I( big, 3 ), Vector2I( 2, 3 ) ) 
+    ? 1 : 0;
+  nb++;
+  nbok += ! ic.getCheckedCrossProduct( cp, Vector2I( 3, big ), Vector2I( -3, 1 ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "overflows of cross products." << std::endl;
+  return nbok == nb;
+}
+
+bool testFixedWidthIntegerComputer()
+{
+  unsigned int nbtests = 50;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef DGtal::int64_t Integer;
+  IntegerComputer<Integer> ic;
+  IntegerComputer<DGtal::int32_t> ic32;
+  trace.beginBlock ( "Testing block: fast paths of int32_t and int64_t." );
+  nbok += testFastPaths<DGtal::int32_t>( ic32 ) ? 1 : 0;
+  nb++;
+  nbok += testFastPaths<Integer>( ic ) ? 1 : 0;
+  nb++;
+  for ( unsigned int i = 0; i < nbtests; ++i )
+    {
+      nbok += testGCD<Integer>( ic ) ? 1 : 0;
+      nb++;
+      nbok += testCFrac<Integer>( ic ) ? 1 : 0;
+      nb++;
+      nbok += testCeilFloorDiv<Integer>( ic ) ? 1 : 0;
+      nb++;
+      nbok += testExtendedEuclid<Integer>( ic ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") int64_t tests." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+#ifdef WITH_GMP
 /**
  * Example of a test. To be completed.
  *
@@ -324,6 +418,7 @@ bool testIntegerComputer()
   
   return nbok == nb;
 }
+#endif // WITH_GMP
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -331,7 +426,11 @@ bool testIntegerComputer()
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegerComputer" );
-  bool res = testIntegerComputer(); // && ... other tests
+  bool res = testFixedWidthIntegerComputer()
+#ifdef WITH_GMP
+    && testIntegerComputer()
+#endif
+    ; // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,174 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStandardDSLQ0-batch-reversedSmartDSS-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/07/04
+ *
+ * Benchmark of the batch StandardDSLQ0::reversedSmartDSS, compared
+ * to reversedSmartDSS called on each subsegment. Outputs the
+ * throughputs in subsegments per second.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/InlineSternBrocot.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class StandardDSLQ0.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Wall-clock time (in ms) with OpenMP, since the threads of the
+/// parallel batch share the process time measured by Clock.
+struct BenchClock
+{
+#ifdef WITH_OPENMP
+  double myStart;
+  void startClock() { myStart = omp_get_wtime(); }
+  double stopClock() { return 1000.0 * ( omp_get_wtime() - myStart ); }
+#else
+  Clock myClock;
+  void startClock() { myClock.startClock(); }
+  double stopClock() { return (double) myClock.stopClock(); }
+#endif
+};
+
+template <typename Fraction>
+bool benchBatchReversedSmartDSS( const std::string & name, bool sliding,
+                                 unsigned int nbtries, unsigned int nbqueries,
+                                 typename Fraction::Integer moda, 
+                                 typename Fraction::Integer modb, 
+                                 typename Fraction::Integer modx )
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename Fraction::Integer Integer;
+  typedef typename DSL::Point Point;
+  typedef std::vector< std::pair<Point,Point> > Queries;
+  IntegerComputer<Integer> ic;
+
+  srandom( 0 );
+  std::vector<DSL> dsls;
+  std::vector<Queries> queries;
+  double nb = 0.0;
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      Integer a( random() % moda + 1 );
+      Integer b( random() % modb + 1 );
+      if ( ic.gcd( a, b ) != 1 ) continue;
+      dsls.push_back( DSL( a, b, random() % (moda+modb) ) );
+      queries.push_back( Queries() );
+      for ( unsigned int j = 0; j < nbqueries; ++j )
+        { // random subsegments, or sliding windows of length modx.
+          Integer x1 = sliding ? Integer( j ) : Integer( random() % modx );
+          Integer x2 = x1 + ( sliding ? modx : 1 + ( random() % modx ) );
+          queries.back().push_back
+            ( std::make_pair( dsls.back().lowestY( x1 ), 
+                              dsls.back().lowestY( x2 ) ) );
+        }
+      nb += nbqueries;
+    }
+
+  BenchClock c;
+  std::vector<DSL> single, batch, parallel;
+  c.startClock();
+  for ( unsigned int i = 0; i < dsls.size(); ++i )
+    for ( unsigned int j = 0; j < queries[ i ].size(); ++j )
+      single.push_back( dsls[ i ].reversedSmartDSS( queries[ i ][ j ].first,
+                                                    queries[ i ][ j ].second ) );
+  double tSingle = c.stopClock();
+  c.startClock();
+  for ( unsigned int i = 0; i < dsls.size(); ++i )
+    dsls[ i ].reversedSmartDSS( queries[ i ].begin(), queries[ i ].end(),
+                                std::back_inserter( batch ), 1 );
+  double tBatch = c.stopClock();
+  c.startClock();
+  for ( unsigned int i = 0; i < dsls.size(); ++i )
+    dsls[ i ].reversedSmartDSS( queries[ i ].begin(), queries[ i ].end(),
+                                std::back_inserter( parallel ), 0 );
+  double tParallel = c.stopClock();
+
+  bool ok = ( single.size() == batch.size() ) 
+    && ( single.size() == parallel.size() );
+  for ( unsigned int i = 0; ok && ( i < single.size() ); ++i )
+    ok = ( single[ i ].mu() == batch[ i ].mu() )
+      && ( single[ i ].mu() == parallel[ i ].mu() );
+  std::cout << name << " " << ( sliding ? "sliding" : "random" )
+            << " " << nbqueries << " " << moda << " " << modb 
+            << " " << modx << " " << nb << " "
+            << ( 1000.0 * nb / tSingle ) << " "
+            << ( 1000.0 * nb / tBatch ) << " "
+            << ( 1000.0 * nb / tParallel ) << std::endl;
+  return ok;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv)
+{
+  typedef SternBrocot<DGtal::int64_t,DGtal::int32_t> SB;
+  typedef InlineSternBrocot<DGtal::int64_t,DGtal::int32_t> ISB;
+  typedef SB::Fraction::Integer Integer;
+  unsigned int nbsegments = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000000;
+  Integer moda = ( argc > 2 ) ? atoll( argv[ 2 ] ) : 12000;
+  Integer modb = ( argc > 3 ) ? atoll( argv[ 3 ] ) : 12000;
+  Integer modx = ( argc > 4 ) ? atoll( argv[ 4 ] ) : 1000;
+  bool ok = true;
+  std::cout << "# fraction queries nbqueries moda modb modx nb"
+            << " single(seg/s) batch(seg/s) parallel-batch(seg/s)" << std::endl;
+  unsigned int nbqueries[] = { 10, 100, 1000, 10000 };
+  for ( unsigned int i = 0; i < 4; ++i )
+    for ( unsigned int j = 0; j < 4; ++j )
+      {
+        bool sliding = ( j >= 2 );
+        Integer ma = ( j % 2 == 0 ) ? moda : 200;
+        Integer mb = ( j % 2 == 0 ) ? modb : 200;
+        Integer mx = sliding ? 50 : modx;
+        unsigned int nbtries = nbsegments / nbqueries[ i ];
+        ok = benchBatchReversedSmartDSS<SB::Fraction>
+          ( "SB", sliding, nbtries, nbqueries[ i ], ma, mb, mx ) && ok;
+        ok = benchBatchReversedSmartDSS<ISB::Fraction>
+          ( "ISB", sliding, nbtries, nbqueries[ i ], ma, mb, mx ) && ok;
+      }
+  return ok ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,145 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStandardDSLQ0.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/07/04
+ *
+ * Functions for testing class StandardDSLQ0.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/InlineSternBrocot.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class StandardDSLQ0.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename DSL>
+bool sameDSL( const DSL & D1, const DSL & D2 )
+{
+  return ( D1.a() == D2.a() ) && ( D1.b() == D2.b() )
+    && ( D1.mu() == D2.mu() );
+}
+
+/**
+   Checks that the batch reversedSmartDSS gives the same DSLs as
+   reversedSmartDSS called on each subsegment.
+*/
+template <typename DSL>
+bool checkBatchReversedSmartDSS( const DSL & D,
+                                 const std::vector< std::pair<typename DSL::Point,
+                                 typename DSL::Point> > & queries,
+                                 unsigned int nbThreads )
+{
+  std::vector<DSL> results;
+  D.reversedSmartDSS( queries.begin(), queries.end(),
+                      std::back_inserter( results ), nbThreads );
+  if ( results.size() != queries.size() ) return false;
+  for ( unsigned int i = 0; i < queries.size(); ++i )
+    {
+      DSL S = D.reversedSmartDSS( queries[ i ].first, queries[ i ].second );
+      if ( ! sameDSL( S, results[ i ] ) )
+        {
+          trace.error() << "D=" << D << " A=" << queries[ i ].first
+                        << " B=" << queries[ i ].second
+                        << " S=" << S << " batch=" << results[ i ]
+                        << std::endl;
+          return false;
+        }
+    }
+  return true;
+}
+
+template <typename Fraction>
+bool testBatchReversedSmartDSS()
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename Fraction::Integer Integer;
+  typedef typename DSL::Point Point;
+  IntegerComputer<Integer> ic;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Check batch reversedSmartDSS == reversedSmartDSS" );
+  for ( unsigned int i = 0; i < 200; ++i )
+    {
+      // small slopes so that many subsegments are translated from
+      // each other, large ones otherwise.
+      Integer mod = ( i % 2 == 0 ) ? 20 : 12000;
+      Integer a( random() % mod + 1 );
+      Integer b( random() % mod + 1 );
+      if ( ic.gcd( a, b ) == 1 )
+        {
+          DSL D( a, b, random() % ( 2 * mod ) );
+          std::vector< std::pair<Point,Point> > queries;
+          for ( unsigned int j = 0; j < 100; ++j )
+            {
+              Integer x1 = random() % 1000 - 500;
+              Integer x2 = x1 + ( random() % ( 2 * b ) );
+              Point A = D.lowestY( x1 );
+              Point B = ( x2 == x1 ) ? D.uppermostY( x1 ) : D.lowestY( x2 );
+              if ( D.before( A, B ) )
+                queries.push_back( std::make_pair( A, B ) );
+            }
+          ++nb, nbok += checkBatchReversedSmartDSS( D, queries, 1 ) ? 1 : 0;
+          ++nb, nbok += checkBatchReversedSmartDSS( D, queries, 0 ) ? 1 : 0;
+        }
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") correct batches."
+               << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int , char** )
+{
+  typedef SternBrocot< DGtal::int64_t, DGtal::int32_t > SB;
+  typedef InlineSternBrocot< DGtal::int64_t, DGtal::int32_t > ISB;
+
+  trace.beginBlock ( "Testing class StandardDSLQ0" );
+  bool res = testBatchReversedSmartDSS<SB::Fraction>()
+    && testBatchReversedSmartDSS<ISB::Fraction>();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
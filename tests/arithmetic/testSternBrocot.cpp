@@ -30,6 +30,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/arithmetic/CPositiveIrreducibleFraction.h"
@@ -799,6 +803,77 @@ bool testContinuedFractions()
 }
 
 
+/**
+ * Stress test of a Stern-Brocot tree shared by several threads (when
+ * DGtal is built with OpenMP): the same fractions and the same
+ * subsegments of DSL are computed concurrently, the tree being empty
+ * at the beginning. Each fraction must be a unique node of the tree.
+ */
+template <typename SB>
+bool testConcurrentSternBrocot()
+{
+  typedef typename SB::Integer Integer;
+  typedef typename SB::Fraction Fraction;
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename DSL::Point Point;
+  IntegerComputer<Integer> ic;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing block: concurrent fractions and DSS." );
+  const int nbtests = 4000;
+  std::vector<Integer> a( nbtests ), b( nbtests ), mu( nbtests ),
+    x1( nbtests ), x2( nbtests );
+  for ( int i = 0; i < nbtests; ++i )
+    {
+      // each fraction is computed by 2 iterations, in 2 threads
+      // for a static schedule
+      if ( i % 2 == 0 ) 
+        {
+          do {
+            a[ i ] = random() % 12000 + 1;
+            b[ i ] = random() % 12000 + 1;
+          } while ( ic.gcd( a[ i ], b[ i ] ) != 1 );
+        }
+      else
+        {
+          a[ i ] = a[ i - 1 ];
+          b[ i ] = b[ i - 1 ];
+        }
+      mu[ i ] = random() % 10000;
+      x1[ i ] = random() % 1000;
+      x2[ i ] = x1[ i ] + 1 + ( random() % 1000 );
+    }
+  std::vector<Fraction> fractions( nbtests );
+  std::vector<char> dssOk( nbtests );
+#ifdef WITH_OPENMP
+  trace.info() << "- " << omp_get_max_threads() << " threads" << std::endl;
+#pragma omp parallel for schedule(static,1)
+#endif
+  for ( int i = 0; i < nbtests; ++i )
+    {
+      fractions[ i ] = SB::fraction( a[ i ], b[ i ] );
+      DSL D( a[ i ], b[ i ], mu[ i ] );
+      Point A = D.lowestY( x1[ i ] );
+      Point B = D.lowestY( x2[ i ] );
+      DSL S = D.reversedSmartDSS( A, B );
+      Fraction f = SB::fraction( S.a(), S.b() );
+      dssOk[ i ] = ( S.slope() == f ) 
+        && D( A ) && D( B ) && S( A ) && S( B ) ? 1 : 0;
+    }
+  for ( int i = 0; i < nbtests; ++i )
+    {
+      ++nb, nbok += ( fractions[ i ] == SB::fraction( a[ i ], b[ i ] ) )
+        && fractions[ i ].equals( a[ i ], b[ i ] ) 
+        && ( dssOk[ i ] == 1 ) ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") unique fractions and correct DSS." 
+               << std::endl;
+  trace.info() << "- nbFractions = " << SB::instance().nbFractions << endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -815,7 +890,8 @@ int main( int , char** )
   bool res = testSternBrocot()
     && testPattern<SB>()
     && testSubStandardDSLQ0<Fraction>()
-    && testContinuedFractions<SB>();
+    && testContinuedFractions<SB>()
+    && testConcurrentSternBrocot< SternBrocot<DGtal::int64_t,DGtal::int64_t> >();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
 
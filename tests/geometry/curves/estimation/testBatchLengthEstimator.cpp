@@ -0,0 +1,205 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchLengthEstimator.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/26
+ *
+ * Functions for testing class BatchLengthEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/ShapeFactory.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/curves/representation/GridCurve.h"
+
+#include "DGtal/geometry/curves/estimation/L1LengthEstimator.h"
+#include "DGtal/geometry/curves/estimation/BLUELocalLengthEstimator.h"
+#include "DGtal/geometry/curves/estimation/DSSLengthEstimator.h"
+#include "DGtal/geometry/curves/estimation/MLPLengthEstimator.h"
+#include "DGtal/geometry/curves/estimation/FPLengthEstimator.h"
+#include "DGtal/geometry/curves/estimation/BatchLengthEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z2i;
+
+typedef Space::RealPoint RealPoint;
+typedef GridCurve<KSpace> Curve;
+typedef Curve::PointsRange PointsRange;
+typedef Curve::ArrowsRange ArrowsRange;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchLengthEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Digitizes balls of various centers and radii at step [h]
+ * and stores their contours into [curves].
+ */
+void makeCurves( vector<Curve> & curves, unsigned int n, double h )
+{
+  typedef Ball2D<Space> Shape;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      double radius = 3 + ( i % 7 ) * 0.7;
+      RealPoint center( ( i % 3 ) * 0.31, ( i % 5 ) * 0.17 );
+      Shape aShape( center, radius );
+      GaussDigitizer<Space,Shape> dig;
+      dig.attach( aShape );
+      dig.init( aShape.getLowerBound() - RealPoint( 1, 1 ),
+                aShape.getUpperBound() + RealPoint( 1, 1 ), h );
+      KSpace K;
+      K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+      SurfelAdjacency<KSpace::dimension> SAdj( true );
+      SCell bel = Surfaces<KSpace>::findABel( K, dig, 10000 );
+      vector<Point> points;
+      Surfaces<KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+      Curve c;
+      c.initFromVector( points );
+      curves.push_back( c );
+    }
+}
+
+/**
+ * Checks that a batch of estimations with [LengthEstimator] on
+ * [ranges] gives the same lengths as one estimation per range.
+ */
+template <typename LengthEstimator>
+bool checkBatch( const string & name, double h,
+                 const vector< typename BatchLengthEstimator<LengthEstimator>::Range > & ranges,
+                 bool isClosed )
+{
+  typedef BatchLengthEstimator<LengthEstimator> Batch;
+  vector<typename Batch::Quantity> lengths;
+  Batch batch;
+  batch.eval( h, ranges, isClosed, lengths );
+  trace.info() << name << ": " << batch.statistics() << std::endl;
+
+  bool flag = ( lengths.size() == ranges.size() )
+    && ( batch.statistics().nbRanges == ranges.size() )
+    && ( batch.statistics().nbThreads >= 1 )
+    && ( batch.statistics().minTime <= batch.statistics().maxTime );
+  for ( unsigned int i = 0; ( i < ranges.size() ) && flag; ++i )
+    {
+      LengthEstimator e;
+      detail::LengthEstimatorInitializer<LengthEstimator>
+        ::init( e, h, ranges[ i ].first, ranges[ i ].second, isClosed );
+      flag = ( e.eval() == lengths[ i ] ) && ( lengths[ i ] > 0 );
+    }
+
+  //with a single thread
+  vector<typename Batch::Quantity> lengths1;
+  batch.eval( h, ranges, isClosed, lengths1, 1 );
+  return flag && ( lengths1 == lengths )
+    && ( batch.statistics().nbThreads == 1 );
+}
+
+bool testBatchLengthEstimator( unsigned int n, double h )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing batches of length estimations" );
+
+  vector<Curve> curves;
+  makeCurves( curves, n, h );
+  trace.info() << curves.size() << " curves, h=" << h << std::endl;
+
+  vector< pair<ArrowsRange::ConstCirculator, ArrowsRange::ConstCirculator> > circulators;
+  vector< pair<ArrowsRange::ConstIterator, ArrowsRange::ConstIterator> > arrows;
+  vector< pair<PointsRange::ConstIterator, PointsRange::ConstIterator> > points;
+  for ( unsigned int i = 0; i < curves.size(); ++i )
+    {
+      ArrowsRange ra = curves[ i ].getArrowsRange();
+      PointsRange rp = curves[ i ].getPointsRange();
+      circulators.push_back( make_pair( ra.c(), ra.c() ) );
+      arrows.push_back( make_pair( ra.begin(), ra.end() ) );
+      points.push_back( make_pair( rp.begin(), rp.end() ) );
+    }
+
+  nbok += checkBatch< L1LengthEstimator<ArrowsRange::ConstCirculator> >
+    ( "L1", h, circulators, true ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "L1LengthEstimator" << std::endl;
+  nbok += checkBatch< BLUELocalLengthEstimator<ArrowsRange::ConstIterator> >
+    ( "BLUE", h, arrows, true ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "BLUELocalLengthEstimator" << std::endl;
+  nbok += checkBatch< DSSLengthEstimator<PointsRange::ConstIterator> >
+    ( "DSS", h, points, true ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "DSSLengthEstimator" << std::endl;
+  nbok += checkBatch< MLPLengthEstimator<PointsRange::ConstIterator> >
+    ( "MLP", h, points, true ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "MLPLengthEstimator" << std::endl;
+  nbok += checkBatch< FPLengthEstimator<PointsRange::ConstIterator> >
+    ( "FP", h, points, true ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "FPLengthEstimator" << std::endl;
+
+  //empty batch
+  typedef BatchLengthEstimator< DSSLengthEstimator<PointsRange::ConstIterator> > Batch;
+  Batch batch;
+  vector<Batch::Range> noRanges;
+  vector<double> lengths( 3, 1.0 );
+  batch.eval( h, noRanges, true, lengths );
+  nbok += ( lengths.empty() && ( batch.statistics().nbRanges == 0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "empty batch" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BatchLengthEstimator" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBatchLengthEstimator( 30, 0.5 )
+    && testBatchLengthEstimator( 10, 0.05 ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
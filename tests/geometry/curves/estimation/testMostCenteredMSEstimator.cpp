@@ -47,6 +47,7 @@
 #include "DGtal/topology/KhalimskySpaceND.h"
 
 #include "DGtal/geometry/curves/representation/GridCurve.h"
+#include "DGtal/geometry/curves/representation/FreemanChain.h"
 #include "DGtal/geometry/curves/representation/ArithmeticalDSS.h"
 #include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
 
@@ -136,6 +137,96 @@ bool testEval(string filename)
   return true;
 }
 
+/**
+ * Compares the stored quantities with the ones 
+ * computed by a new estimator
+ */
+template <typename SegmentComputer, typename Functor, typename ConstIterator>
+bool sameQuantities(MostCenteredMaximalSegmentEstimator<SegmentComputer,Functor>& e, 
+                    const ConstIterator& itb, const ConstIterator& ite, 
+                    const bool& isClosed)
+{
+  typedef typename Functor::Value Value; 
+  SegmentComputer sc;
+  Functor f; 
+  MostCenteredMaximalSegmentEstimator<SegmentComputer,Functor> ref(sc,f); 
+  ref.init(1,itb,ite,isClosed);
+  vector<Value> v1, v2; 
+  ref.eval(itb,ite,back_inserter(v1)); 
+  e.eval(itb,ite,back_inserter(v2)); 
+  bool flag = (v1 == v2);
+  //queries at one element
+  for (ConstIterator i = itb; (i != ite)&&(flag); ++i)
+    flag = ( e.eval(i) == v1[i-itb] ); 
+  return flag; 
+}
+
+/**
+ * Test of the stored quantities,
+ * which are updated while the corners 
+ * of the curve are flipped
+ */
+bool testIndex(const vector<PointVector<2,int> >& aContour, const bool& isClosed)
+{
+  typedef PointVector<2,int> Point; 
+  typedef vector<Point>::const_iterator ConstIterator;
+  typedef ArithmeticalDSS<ConstIterator,int,4> SegmentComputer;
+  typedef TangentFromDSSFunctor<SegmentComputer> Functor;
+  typedef MostCenteredMaximalSegmentEstimator<SegmentComputer,Functor> Estimator;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Stored quantities" );
+  trace.info() << aContour.size() << " points, processed as " 
+               << ( (isClosed)?"closed":"open" ) << endl;
+
+  vector<Point> c( aContour ); 
+  SegmentComputer sc;
+  Functor f; 
+  Estimator e(sc,f); 
+  e.init(1,c.begin(),c.end(),isClosed);
+  e.buildIndex(); 
+  nbok += ( (e.isIndexed()) && (sameQuantities(e, c.begin(), c.end(), isClosed)) )?1:0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") after buildIndex()" << endl;
+
+  //flips the corners p[k] of the curve, either one by one 
+  //or by pairs, and updates the stored quantities
+  unsigned int n = c.size(); 
+  bool flag = true; 
+  for (unsigned int t = 0; (t < 40)&&(flag); ++t) {
+    unsigned int k = (t*t*37 + t*101 + 2) % (n-4) + 2; 
+    unsigned int l = k; 
+    for (unsigned int j = 0; j < ((t%3 == 0)?2:1); ++j, l += 5) {
+      if (l+2 < n) {
+        Point q = c[l-1] + c[l+1] - c[l]; 
+        if ( (q != c[l]) && (q != c[l-2]) && (q != c[l+2]) ) 
+          c[l] = q;
+      }
+    }
+    e.update(c.begin()+k, c.begin() + std::min(l, n)); 
+    flag = sameQuantities(e, c.begin(), c.end(), isClosed); 
+  }
+  nbok += (flag)?1:0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") after update()" << endl;
+
+  //ranges of stored quantities
+  if (isClosed) {
+    Estimator ref(sc,f); 
+    ref.init(1,c.begin(),c.end(),isClosed);
+    vector<Functor::Value> v1, v2; 
+    ref.eval(c.end()-3,c.begin()+2,back_inserter(v1)); 
+    e.eval(c.end()-3,c.begin()+2,back_inserter(v2)); 
+    nbok += ( (v1 == v2)&&(v2.size() == 5) )?1:0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") range crossing the last element" << endl;
+  }
+
+  trace.endBlock();
+  return (nbok == nb);
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -153,9 +244,22 @@ int main(int argc, char **argv)
   std::string square = testPath + "samples/smallSquare.dat";
   std::string dss = testPath + "samples/DSS.dat";
 
+  //contours for the stored quantities
+  typedef FreemanChain<int> FC; 
+  std::string ball = testPath + "samples/SmallBall.fc";
+  std::fstream fst;
+  fst.open (ball.c_str(), ios::in);
+  FC fc(fst); 
+  vector<PointVector<2,int> > contour; 
+  FC::getContourPoints(fc, contour); 
+  vector<PointVector<2,int> > part( contour.begin(), contour.begin() + contour.size()/2 ); 
+
   bool res = testEval(sinus2D4)
             && testEval(square)
             && testEval(dss)
+            && testIndex(contour, true)
+            && testIndex(contour, false)
+            && testIndex(part, false)
 //other tests
 ;
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -289,6 +289,33 @@ bool testCompareEstimator(const std::string &name, Shape & aShape, double h)
       trace.info()<< "Error mean= "<< error2.mean()<<std::endl;
       trace.info()<< "Error max= "<< error2.max()<<std::endl;
 
+      //whole range comparisons
+      typename Comparator::ErrorNorms norms;
+      typename Comparator::OutputStatistic error3=Comparator::compareRange(curvatureEstimator, curvatureEstimatorBis,
+                       r.begin(),
+                       r.end(), norms);
+      trace.info()<< "Range: nb samples= "<< error3.samples()
+                  << " L1= "<< norms.l1 << " L2= "<< norms.l2
+                  << " Linf= "<< norms.linf <<std::endl;
+      ok = ok && ( error3.samples() == error.samples() )
+        && ( norms.samples == error.samples() )
+        && ( std::fabs( error3.mean() - error.mean() ) < 1e-9 )
+        && ( norms.linf == 0.0 );
+
+      typename ComparatorTan::ErrorNorms norms2;
+      typename ComparatorTan::OutputVectorStatistic error4=ComparatorTan::compareVectorsRange(tang1, tang2,
+                       r.begin(),
+                       r.end(), norms2, false, true);
+      trace.info()<< "Range: nb samples= "<< error4.samples()
+                  << " L1= "<< norms2.l1 << " L2= "<< norms2.l2
+                  << " Linf= "<< norms2.linf <<std::endl;
+      ok = ok && ( error4.samples() == error2.samples() )
+        && ( std::fabs( error4.mean() - error2.mean() ) < 1e-9 )
+        && ( std::fabs( error4.max() - error2.max() ) < 1e-9 )
+        && ( std::fabs( norms2.l1 - error2.mean() ) < 1e-9 )
+        && ( norms2.l1 <= norms2.l2 + 1e-12 )
+        && ( std::fabs( norms2.linf - error2.max() ) < 1e-9 );
+
 
      }    
     catch ( InputException e )
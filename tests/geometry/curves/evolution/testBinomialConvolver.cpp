@@ -29,9 +29,12 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cmath>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/geometry/curves/evolution/BinomialConvolver.h"
+#include "DGtal/geometry/curves/evolution/MultiScaleBinomialConvolver.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -119,6 +122,85 @@ bool testBinomialConvolver()
   return nbok == nb;
 }
 
+/**
+ * @return 'true' if [a] and [b] are equal up to rounding errors.
+ */
+bool areClose( double a, double b )
+{
+  return std::fabs( a - b ) <= 1e-9 * ( 1.0 + std::fabs( a ) + std::fabs( b ) );
+}
+
+bool areClose( const std::pair<double,double> & a,
+               const std::pair<double,double> & b )
+{
+  return areClose( a.first, b.first ) && areClose( a.second, b.second );
+}
+
+/**
+ * Compares a multi-scale binomial convolver with a binomial convolver
+ * of each size, on a digitized circle.
+ */
+bool testMultiScaleBinomialConvolver( bool isClosed )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( std::string( "Testing MultiScaleBinomialConvolver, " )
+                     + ( isClosed ? "closed" : "open" ) + " contour" );
+  typedef PointVector<2, double> RealPoint;
+  std::vector< RealPoint > points;
+  for ( unsigned int i = 0; i < 500; ++i )
+    {
+      double t = 2.0 * M_PI * i / 500.0;
+      points.push_back( RealPoint( floor( 80.0 * cos( t ) + 0.5 ),
+                                   floor( 60.0 * sin( t ) + 0.5 ) ) );
+    }
+  typedef std::vector< RealPoint >::const_iterator ConstIteratorOnPoints;
+  typedef BinomialConvolver<ConstIteratorOnPoints, double> MyBinomialConvolver;
+  typedef MultiScaleBinomialConvolver<ConstIteratorOnPoints, double> MyMultiScaleBinomialConvolver;
+
+  //unsorted sizes, with a duplicate and 0
+  std::vector<unsigned int> sizes;
+  sizes.push_back( 12 );
+  sizes.push_back( 1 );
+  sizes.push_back( 0 );
+  sizes.push_back( 40 );
+  sizes.push_back( 5 );
+  sizes.push_back( 12 );
+
+  MyMultiScaleBinomialConvolver msbc;
+  msbc.init( 0.5, points.begin(), points.end(), isClosed, sizes );
+  trace.info() << msbc << std::endl;
+  nbok += ( msbc.isValid() && ( msbc.nbScales() == sizes.size() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nbScales() == " << sizes.size() << std::endl;
+
+  bool flag = true;
+  for ( unsigned int s = 0; ( s < sizes.size() ) && flag; ++s )
+    {
+      MyBinomialConvolver bcc( sizes[ s ] );
+      bcc.init( 0.5, points.begin(), points.end(), isClosed );
+      flag = ( msbc.size( s ) == sizes[ s ] );
+      for ( unsigned int i = 0; ( i < points.size() ) && flag; ++i )
+        {
+          flag = areClose( bcc.x( i ), msbc.x( s, i ) )
+            && areClose( bcc.dx( i ), msbc.dx( s, i ) )
+            && areClose( bcc.d2x( i ), msbc.d2x( s, i ) )
+            && areClose( bcc.tangent( i ), msbc.tangent( s, i ) )
+            && areClose( bcc.curvature( i ), msbc.curvature( s, i ) );
+        }
+      flag = flag && ( msbc.index( points.begin() + 7 ) == 7 );
+    }
+  nbok += flag ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values as BinomialConvolver" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -130,7 +212,9 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testBinomialConvolver(); // && ... other tests
+  bool res = testBinomialConvolver()
+    && testMultiScaleBinomialConvolver( true )
+    && testMultiScaleBinomialConvolver( false ); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
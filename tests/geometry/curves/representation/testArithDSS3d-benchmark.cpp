@@ -0,0 +1,146 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testArithDSS3d-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/28
+ *
+ * Benchmark of the computation of the maximal 3d DSS of long
+ * 6-connected helices, with ArithmeticalDSS3dCover and with a
+ * SaturatedSegmentation of ArithmeticalDSS3d.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/representation/ArithmeticalDSS3d.h"
+#include "DGtal/geometry/curves/representation/ArithmeticalDSS3dCover.h"
+#include "DGtal/geometry/curves/representation/SaturatedSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<3,int> Point;
+typedef vector<Point>::const_iterator ConstIterator;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class ArithmeticalDSS3dCover.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Digitizes [nbTurns] turns of a helix of radius [radius] and pitch
+ * [pitch] into the 6-connected curve [points]: two consecutive
+ * rounded points are joined by steps along one axis at a time.
+ */
+void helix( vector<Point> & points, double radius, double pitch, unsigned int nbTurns )
+{
+  const double pi = 3.14159265358979323846;
+  unsigned int n = (unsigned int) ( 8 * radius * nbTurns );
+  points.clear();
+  points.push_back( Point( (int) floor( radius + 0.5 ), 0, 0 ) );
+  for ( unsigned int i = 1; i <= n; ++i )
+    {
+      double t = 2 * pi * nbTurns * i / n;
+      Point q( (int) floor( radius * cos( t ) + 0.5 ),
+               (int) floor( radius * sin( t ) + 0.5 ),
+               (int) floor( pitch * t / ( 2 * pi ) + 0.5 ) );
+      for ( Dimension k = 0; k < 3; ++k )
+        while ( points.back()[ k ] != q[ k ] )
+          {
+            Point p( points.back() );
+            p[ k ] += ( q[ k ] > p[ k ] ) ? 1 : -1;
+            points.push_back( p );
+          }
+    }
+}
+
+bool benchmarkCover( double radius, double pitch, unsigned int nbTurns )
+{
+  typedef ArithmeticalDSS3d<ConstIterator,int,4> SegmentComputer;
+  typedef SaturatedSegmentation<SegmentComputer> Segmentation;
+  typedef ArithmeticalDSS3dCover<ConstIterator,int,4> Cover;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  vector<Point> points;
+  helix( points, radius, pitch, nbTurns );
+
+  trace.beginBlock( "Benchmarking maximal 3d DSS of a helix" );
+  trace.info() << points.size() << " points, radius " << radius
+               << ", pitch " << pitch << std::endl;
+
+  Clock clock;
+  clock.startClock();
+  Cover cover( points.begin(), points.end() );
+  double t1 = clock.stopClock();
+
+  clock.startClock();
+  SegmentComputer algo;
+  Segmentation segmentation( points.begin(), points.end(), algo );
+  vector< pair<ConstIterator,ConstIterator> > ranges;
+  for ( Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itEnd = segmentation.end(); it != itEnd; ++it )
+    ranges.push_back( make_pair( it->begin(), it->end() ) );
+  double t2 = clock.stopClock();
+
+  trace.info() << cover.size() << " maximal segments" << std::endl;
+  trace.info() << "ArithmeticalDSS3dCover: " << t1 << " ms, "
+               << "SaturatedSegmentation: " << t2 << " ms" << std::endl;
+
+  bool flag = ( cover.size() == ranges.size() );
+  Cover::ConstIterator s = cover.begin();
+  for ( unsigned int i = 0; ( i < ranges.size() ) && flag; ++i, ++s )
+    flag = ( s->begin == ranges[ i ].first ) && ( s->end == ranges[ i ].second );
+  nbok += flag ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same segments" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class ArithmeticalDSS3dCover" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkCover( 100, 50, 50 )
+    && benchmarkCover( 1000, 300, 10 ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
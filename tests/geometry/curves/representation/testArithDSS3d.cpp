@@ -47,6 +47,9 @@
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/curves/representation/ArithmeticalDSS3d.h"
 #include "DGtal/geometry/curves/representation/GreedySegmentation.h"
+#include "DGtal/geometry/curves/representation/ArithmeticalDSS3dCover.h"
+#include "DGtal/io/readers/PointListReader.h"
+#include "ConfigTest.h"
 
 using namespace DGtal;
 using namespace std;
@@ -154,6 +157,108 @@ bool testSegmentation()
   return (c==2);
 }
 
+/**
+ * Checks that the segments of an ArithmeticalDSS3dCover of
+ * [sequence] are the maximal 3d DSS obtained by extending an
+ * ArithmeticalDSS3d as much as possible from each point.
+ */
+template <typename Point>
+bool checkCover( const std::vector<Point>& sequence )
+{
+  typedef typename std::vector<Point>::const_iterator Iterator;
+  typedef ArithmeticalDSS3d<Iterator,int,4> SegmentComputer;
+  typedef ArithmeticalDSS3dCover<Iterator,int,4> Cover;
+
+  Cover cover( sequence.begin(), sequence.end() );
+  trace.info() << cover << std::endl;
+
+  typename Cover::ConstIterator s = cover.begin();
+  Iterator lastEnd = sequence.begin();
+  for (Iterator it = sequence.begin(); it != sequence.end(); ++it) {
+    SegmentComputer algo;
+    algo.init(it);
+    while ( (algo.end() != sequence.end()) && algo.extendForward() ) {}
+    if (algo.end() != lastEnd) {
+      if (s == cover.end()) return false;
+      if ( (s->begin != algo.begin()) || (s->end != algo.end()) ) {
+        trace.info() << "bad range starting at " << *algo.begin() << std::endl;
+        return false;
+      }
+      typename SegmentComputer::Vector3d direction;
+      typename SegmentComputer::PointD3d intercept, thickness;
+      algo.getParameters( direction, intercept, thickness );
+      if ( (s->direction != direction) || (s->intercept != intercept)
+           || (s->thickness != thickness) ) {
+        trace.info() << "bad parameters starting at " << *algo.begin() << std::endl;
+        return false;
+      }
+      ++s;
+      lastEnd = algo.end();
+    }
+  }
+  return (s == cover.end());
+}
+
+/**
+ * maximal segments test
+ *
+ */
+bool testCover()
+{
+  typedef PointVector<3,int> Point;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock("Maximal segments test");
+
+  std::vector<Point> sequence;
+  sequence.push_back(Point(0,0,0));
+  sequence.push_back(Point(1,0,0));
+  sequence.push_back(Point(2,0,0));
+  sequence.push_back(Point(2,1,0));
+  sequence.push_back(Point(2,1,1));
+  sequence.push_back(Point(3,1,1));
+  sequence.push_back(Point(4,1,1));
+  sequence.push_back(Point(4,2,1));
+  sequence.push_back(Point(4,2,2));
+  sequence.push_back(Point(5,2,2));
+  sequence.push_back(Point(6,2,2));
+  sequence.push_back(Point(6,3,2));
+  sequence.push_back(Point(6,3,3));
+  sequence.push_back(Point(6,4,3));
+  sequence.push_back(Point(6,4,4));
+  sequence.push_back(Point(6,5,4));
+  nbok += checkCover( sequence ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "simple sequence" << std::endl;
+
+  std::string filename = testPath + "samples/sinus3D.dat";
+  std::vector<Point> sinus = PointListReader<Point>::getPointsFromFile( filename );
+  trace.info() << sinus.size() << " points read in " << filename << std::endl;
+  nbok += ( (sinus.size() > 0) && checkCover( sinus ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "sinus3D" << std::endl;
+
+  //disconnected parts
+  std::vector<Point> parts( sinus );
+  for (unsigned int i = 0; i < sequence.size(); ++i)
+    parts.push_back( sequence[i] + Point(100,100,100) );
+  parts.push_back( Point(0,0,0) );
+  nbok += checkCover( parts ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "disconnected parts" << std::endl;
+
+  std::vector<Point> single( 1, Point(1,2,3) );
+  ArithmeticalDSS3dCover<std::vector<Point>::const_iterator,int,4>
+    cover( single.begin(), single.end() );
+  nbok += ( (cover.size() == 1) && checkCover( single ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "single point" << std::endl;
+
+  trace.endBlock();
+  return (nbok == nb);
+}
+
 int main(int argc, char **argv)
 {
 
@@ -165,6 +270,7 @@ int main(int argc, char **argv)
 
   bool res = testDSSreco() 
         && testSegmentation()
+        && testCover()
   ;
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -0,0 +1,166 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/21
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/representation/FreemanChain.h"
+#include "DGtal/geometry/curves/representation/PackedFreemanChain.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef FreemanChain<int> FC;
+typedef PackedFreemanChain<int> PFC;
+
+/**
+ * @return 'true' if [pc] and [fc] have the same codes and points.
+ */
+bool sameChains( const PFC & pc, const FC & fc )
+{
+  if ( ( pc.size() != fc.size() ) || ( pc.chain() != fc.chain )
+       || ( pc.firstPoint() != fc.firstPoint() )
+       || ( pc.lastPoint() != fc.lastPoint() ) )
+    return false;
+
+  vector<FC::Point> v1, v2;
+  FC::getContourPoints( fc, v1 );
+  pc.getPoints( back_inserter( v2 ) );
+  if ( v1 != v2 )
+    return false;
+  for ( PFC::Index i = 0; i <= pc.size(); i += 1 + i / 7 )
+    if ( pc.getPoint( i ) != v1[ i ] )
+      return false;
+  return ( pc.totalDisplacement() == fc.lastPoint() - fc.firstPoint() )
+    && ( pc.unpack() == fc );
+}
+
+bool testPackedFreemanChain( const string & filename )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing packed chain from " + filename );
+
+  fstream fst;
+  fst.open( filename.c_str(), ios::in );
+  FC fc( fst );
+  PFC pc( fc );
+  nbok += ( pc.isValid() && sameChains( pc, fc ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << pc << std::endl;
+
+  //subchains, at every offset modulo 4
+  bool flag = true;
+  const unsigned int n = fc.size();
+  for ( unsigned int pos = 0; ( pos < 9 ) && flag; ++pos )
+    {
+      flag = sameChains( pc.subChain( pos, n - 2 * pos ),
+                         fc.subChain( pos, n - 2 * pos ) )
+        && sameChains( pc.subChain( n / 3 + pos, pos + 1 ),
+                       fc.subChain( n / 3 + pos, pos + 1 ) );
+    }
+  nbok += flag ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "subChain()" << std::endl;
+
+  //concatenations of subchains, and of a chain with itself
+  flag = true;
+  for ( unsigned int pos = 1; ( pos < 9 ) && flag; ++pos )
+    {
+      PFC p1 = pc.subChain( 0, n / 2 + pos );
+      PFC p2 = pc.subChain( n / 2 + pos, n / 2 - pos - 1 );
+      FC f1 = fc.subChain( 0, n / 2 + pos );
+      FC f2 = fc.subChain( n / 2 + pos, n / 2 - pos - 1 );
+      flag = sameChains( p1 + p2, f1 + f2 ) && sameChains( p2 + p1, f2 + f1 );
+      p1 += p2;
+      f1 += f2;
+      flag = flag && sameChains( p1, f1 ) && sameChains( pc, fc );
+      p2 += p2;
+      f2 += f2;
+      flag = flag && sameChains( p2, f2 );
+    }
+  nbok += flag ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "operator+() and operator+=()" << std::endl;
+
+  //extension, in place or not
+  PFC pc2( pc );
+  PFC pc3 = pc.subChain( 5, 1000 );
+  FC fc2( fc );
+  FC fc3 = fc.subChain( 5, 1000 );
+  const std::string codes = "0112230";
+  for ( unsigned int i = 0; i < 600; ++i )
+    {
+      pc2.extend( codes[ i % 7 ] );
+      fc2.extend( codes[ i % 7 ] );
+      pc3.extend( codes[ ( i * 3 ) % 7 ] );
+      fc3.extend( codes[ ( i * 3 ) % 7 ] );
+    }
+  nbok += ( sameChains( pc2, fc2 ) && sameChains( pc3, fc3 )
+            && sameChains( pc, fc ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "extend()" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PackedFreemanChain" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPackedFreemanChain( testPath + "samples/SmallBall.fc" )
+    && testPackedFreemanChain( testPath + "samples/klokan.fc" ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -932,9 +932,115 @@ bool SaturatedSegmentationTest()
   trace.info() << "# nbpts nbsegments " << endl;
   trace.info() << fc.size()+1 << " " << compteur << endl;
 
+  vector<RecognitionAlgorithm> segments; 
+  s.copySegments( back_inserter(segments), 4 ); 
+  trace.info() << "by chunks: " << segments.size() << endl;
+
+  trace.endBlock();
+
+  return (compteur == 4295) && (segments.size() == 4295);
+}
+
+/**
+ * Compares the chunked computation of the segments 
+ * with the sequential iteration
+ */
+template <typename Iterator>
+bool compareChunkedSegmentation(const Iterator& itb, const Iterator& ite, 
+                                const Iterator& sitb, const Iterator& site)
+{
+  typedef typename IteratorCirculatorTraits<Iterator>::Value::Coordinate Coordinate; 
+  typedef ArithmeticalDSS<Iterator,Coordinate,4> RecognitionAlgorithm;
+  typedef SaturatedSegmentation<RecognitionAlgorithm> Segmentation;
+
+  const string modes[3] = { "First", "MostCentered", "Last" }; 
+  bool flag = true; 
+  for (unsigned int m = 0; m < 3; ++m) {
+    RecognitionAlgorithm algo;
+    Segmentation s(itb,ite,algo);
+    s.setSubRange(sitb,site);
+    s.setMode(modes[m]);
+
+    vector<RecognitionAlgorithm> ref; 
+    for (typename Segmentation::SegmentComputerIterator i = s.begin(), 
+           end = s.end(); i != end; ++i) 
+      ref.push_back( *i ); 
+
+    for (unsigned int nbChunks = 0; nbChunks < 8; ++nbChunks) {
+      vector<RecognitionAlgorithm> res; 
+      s.copySegments( back_inserter(res), nbChunks ); 
+      bool ok = ( res.size() == ref.size() ); 
+      for (unsigned int k = 0; ( ok && (k < res.size()) ); ++k) 
+        ok = ( res[k].begin() == ref[k].begin() ) 
+          && ( res[k].end() == ref[k].end() ) 
+          && ( res[k] == ref[k] ); 
+      if (!ok) 
+        trace.info() << "mode " << modes[m] << ", " << nbChunks << " chunks: " 
+                     << res.size() << " segments instead of " << ref.size() << endl; 
+      flag = flag && ok; 
+    }
+  }
+  return flag; 
+}
+
+/**
+ * Test of the chunked computation of the segments
+ */
+bool SaturatedSegmentationChunksTest()
+{
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC; 
+  typedef PointVector<2,Coordinate> Point; 
+  typedef vector<Point>::const_iterator ConstIterator; 
+  typedef Circulator<ConstIterator> ConstCirculator; 
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock("Chunked saturated segmentation");
+
+  std::string filename = testPath + "samples/manche.fc";
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  FC fc(fst);
+  vector<Point> vPts; 
+  vPts.assign(fc.begin(),fc.end()); 
+
+  nbok += compareChunkedSegmentation<ConstIterator>
+    (vPts.begin(), vPts.end(), vPts.begin(), vPts.end()) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") open curve" << std::endl;
+
+  nbok += compareChunkedSegmentation<ConstIterator>
+    (vPts.begin(), vPts.end(), vPts.begin()+15, vPts.begin()+200) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") subrange" << std::endl;
+
+  nbok += compareChunkedSegmentation<FC::ConstIterator>
+    (fc.begin(), fc.end(), fc.begin(), fc.end()) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") open curve (FreemanChain iterators)" << std::endl;
+
+  std::stringstream ss(stringstream::in | stringstream::out);
+  ss << "31 16 1112121212121221212121221212212222232232323332333333332333332330333033003030000010001001001000100010101010111" << endl;
+  FC fc2(ss);
+  vector<Point> vPts2; 
+  vPts2.assign(fc2.begin(),fc2.end()); 
+  ConstCirculator c(vPts2.begin(), vPts2.begin(), vPts2.end() ); 
+
+  nbok += compareChunkedSegmentation<ConstCirculator>(c, c, c, c) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") closed curve" << std::endl;
+
+  ConstCirculator cstart(vPts2.begin()+80, vPts2.begin(), vPts2.end() ); 
+  ConstCirculator cstop(vPts2.begin()+20, vPts2.begin(), vPts2.end() ); 
+  nbok += compareChunkedSegmentation<ConstCirculator>(c, c, cstart, cstop) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") subrange of a closed curve" << std::endl;
+
   trace.endBlock();
 
-  return (compteur == 4295);
+  return nbok == nb;
 }
 
 /////////////////////////////////////////////////////////////////////////
@@ -953,6 +1059,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& SaturatedSegmentationChunksTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
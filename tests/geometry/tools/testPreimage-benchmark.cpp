@@ -0,0 +1,186 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPreimage-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/22
+ *
+ * Benchmark of Preimage2D with hulls stored in a std::deque or in a
+ * std::list, and of FP, on long noisy contours.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <list>
+#include <deque>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/geometry/curves/representation/FreemanChain.h"
+#include "DGtal/geometry/curves/representation/GridCurve.h"
+#include "DGtal/geometry/curves/representation/FP.h"
+#include "DGtal/geometry/tools/Preimage2D.h"
+#include "DGtal/shapes/fromPoints/StraightLineFrom2Points.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND<2,int> KSpace;
+typedef GridCurve<KSpace> Curve;
+typedef Curve::Point Point;
+typedef StraightLineFrom2Points<Point> StraightLine;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class Preimage2D.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the codes of a x-monotone 4-connected path of
+ * [n] steps, made of long noisy digital straight parts.
+ */
+string noisyCodes( unsigned int n, unsigned int seed )
+{
+  srand( seed );
+  string codes;
+  codes.reserve( n );
+  char vertical = '1';
+  int slope = 1 + rand() % 8;
+  while ( codes.size() < n )
+    {
+      if ( rand() % 500 == 0 ) //new part
+        {
+          slope = 1 + rand() % 8;
+          vertical = ( rand() % 2 == 0 ) ? '1' : '3';
+        }
+      //one horizontal step every [slope] steps, with some noise
+      codes.push_back( ( rand() % slope == 0 ) || ( rand() % 17 == 0 )
+                       ? '0' : vertical );
+    }
+  return codes;
+}
+
+/**
+ * Greedy segmentation of the incident points of [c] into preimages
+ * of straight lines, with the hulls stored in a container of type
+ * [Container].
+ * @return the number of segments, their leaning points
+ * being written in [aLeaningPoints].
+ */
+template <typename Container>
+unsigned int segmentation( const Curve & c, vector<Point> & aLeaningPoints )
+{
+  typedef Preimage2D<StraightLine, Container> Preimage;
+  typedef Curve::IncidentPointsRange Range;
+  StraightLine aStraightLine;
+  Range r = c.getIncidentPointsRange();
+  Range::ConstIterator it = r.begin(), itEnd = r.end();
+  unsigned int nb = 0;
+  aLeaningPoints.clear();
+  while ( it != itEnd )
+    {
+      Preimage thePreimage( it->first, it->second, aStraightLine );
+      ++it;
+      while ( ( it != itEnd ) && ( thePreimage.addFront( it->first, it->second ) ) )
+        ++it;
+      aLeaningPoints.push_back( thePreimage.getUf() );
+      aLeaningPoints.push_back( thePreimage.getUl() );
+      aLeaningPoints.push_back( thePreimage.getLf() );
+      aLeaningPoints.push_back( thePreimage.getLl() );
+      ++nb;
+    }
+  return nb;
+}
+
+bool benchmarkPreimage( unsigned int n, unsigned int nbRuns )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  FreemanChain<int> fc( noisyCodes( n, n ), 0, 0 );
+  vector<Point> points;
+  FreemanChain<int>::getContourPoints( fc, points );
+  Curve c;
+  c.initFromVector( points );
+
+  trace.beginBlock( "Benchmarking preimages on a noisy contour" );
+  trace.info() << points.size() << " points, " << nbRuns << " runs" << std::endl;
+
+  Clock clock;
+  vector<Point> leaningPoints1, leaningPoints2;
+  unsigned int nbSegments1 = 0, nbSegments2 = 0;
+  clock.startClock();
+  for ( unsigned int i = 0; i < nbRuns; ++i )
+    nbSegments1 = segmentation< list<Point> >( c, leaningPoints1 );
+  double t1 = clock.stopClock();
+  clock.startClock();
+  for ( unsigned int i = 0; i < nbRuns; ++i )
+    nbSegments2 = segmentation< deque<Point> >( c, leaningPoints2 );
+  double t2 = clock.stopClock();
+  trace.info() << nbSegments1 << " segments" << std::endl;
+  trace.info() << "std::list: " << t1 << " ms, std::deque: " << t2 << " ms" << std::endl;
+  nbok += ( ( nbSegments1 == nbSegments2 ) && ( leaningPoints1 == leaningPoints2 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same segments" << std::endl;
+
+  typedef FP<FreemanChain<int>::ConstIterator, int, 4> FaithfulPolygon;
+  FaithfulPolygon::Polygon::size_type size = 0;
+  clock.startClock();
+  for ( unsigned int i = 0; i < nbRuns; ++i )
+    {
+      FaithfulPolygon theFP( fc.begin(), fc.end(), false );
+      size = theFP.size();
+    }
+  double t3 = clock.stopClock();
+  trace.info() << "FP: " << size << " vertices, " << t3 << " ms" << std::endl;
+  nbok += ( size > 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "FP" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class Preimage2D" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkPreimage( 100000, 10 )
+    && benchmarkPreimage( 1000000, 2 ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
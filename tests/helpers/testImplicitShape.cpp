@@ -33,6 +33,8 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/shapes/ShapeFactory.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/io/colormaps/GrayscaleColorMap.h"
 #include "DGtal/io/writers/VolWriter.h"
@@ -153,6 +155,172 @@ bool testImplicitShape3D()
   return nbok == nb;
 }
 
+/**
+ * Checks that parallelEuclideanShaper gives the same set as
+ * euclideanShaper for the shape [aShape] at grid step [h], and that
+ * parallelDigitalShaperInImage sets the same points.
+ */
+template <typename TDomain, typename TDigitalSet, typename TShape>
+bool checkParallelShaper( const TDomain & domain, const TShape & aShape, double h )
+{
+  TDigitalSet set( domain ), set2( domain );
+  Shapes<TDomain>::euclideanShaper( set, aShape, h );
+  Shapes<TDomain>::parallelEuclideanShaper( set2, aShape, h );
+  bool ok = ( set.size() == set2.size() ) && ( set.size() > 0 );
+  for ( typename TDigitalSet::ConstIterator it = set.begin(), itend = set.end();
+        ok && ( it != itend ); ++it )
+    ok = ( set2.find( *it ) != set2.end() );
+
+  GaussDigitizer<typename TDomain::Space, TShape> dig;
+  dig.attach( aShape );
+  dig.init( aShape.getLowerBound(), aShape.getUpperBound(), h );
+  typedef ImageContainerBySTLVector<TDomain, DGtal::uint8_t> Image;
+  Image image( dig.getDomain() );
+  Shapes<TDomain>::parallelDigitalShaperInImage( image, dig, 1 );
+  unsigned int nbInside = 0;
+  for ( typename Image::Domain::ConstIterator it = image.domain().begin(),
+          itend = image.domain().end(); it != itend; ++it )
+    if ( image( *it ) == 1 )
+      {
+        ++nbInside;
+        ok = ok && ( set.find( *it ) != set.end() );
+      }
+  ok = ok && ( nbInside == set.size() );
+  trace.info() << set.size() << " points, h=" << h << std::endl;
+  return ok;
+}
+
+bool testParallelShaper()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing parallel shapers ..." );
+  Z2i::Domain domain2( Z2i::Point( -100, -100 ), Z2i::Point( 100, 100 ) );
+  nbok += checkParallelShaper<Z2i::Domain, Z2i::DigitalSet>
+    ( domain2, ImplicitBall<Z2i::Space>( Z2i::Space::RealPoint( 0.3, 0.1 ), 10 ), 0.5 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D ball" << std::endl;
+  nbok += checkParallelShaper<Z2i::Domain, Z2i::DigitalSet>
+    ( domain2, ImplicitRoundedHyperCube<Z2i::Space>( Z2i::Space::RealPoint( 0, 0 ), 10, 2.5 ), 1.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D rounded cube" << std::endl;
+
+  Z3i::Domain domain3( Z3i::Point( -40, -40, -40 ), Z3i::Point( 40, 40, 40 ) );
+  nbok += checkParallelShaper<Z3i::Domain, Z3i::DigitalSet>
+    ( domain3, ImplicitRoundedHyperCube<Z3i::Space>( Z3i::Space::RealPoint( 0.2, 0, 0.5 ), 10, 2.5 ), 0.7 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D rounded cube" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Shape that counts the evaluations of the points of another shape,
+ * within the given bounding box.
+ */
+template <typename TShape>
+struct CountingShape
+{
+  typedef typename TShape::Space Space;
+  typedef typename Space::RealPoint RealPoint;
+
+  CountingShape( const TShape & aShape,
+                 const RealPoint & aLow, const RealPoint & anUp )
+    : myShape( &aShape ), myLow( aLow ), myUp( anUp ), myCount( 0 )
+  {}
+  Orientation orientation( const RealPoint & aPoint ) const
+  {
+    ++myCount;
+    return myShape->orientation( aPoint );
+  }
+  Orientation orientation( const RealPoint & aLow, const RealPoint & anUp ) const
+  {
+    return myShape->orientation( aLow, anUp );
+  }
+  RealPoint getLowerBound() const { return myLow; }
+  RealPoint getUpperBound() const { return myUp; }
+
+  const TShape* myShape;
+  RealPoint myLow, myUp;
+  mutable unsigned int myCount;
+};
+
+/**
+ * Checks that hierarchicalEuclideanShaper gives the same set as
+ * euclideanShaper for the shape [aShape] at grid step [h], while
+ * evaluating less than [ratio] times the points of the bounding box.
+ */
+template <typename TDomain, typename TDigitalSet, typename TShape>
+bool checkHierarchicalShaper( const TDomain & domain, const TShape & aShape,
+                              const typename TDomain::Space::RealPoint & aLow,
+                              const typename TDomain::Space::RealPoint & anUp,
+                              double h, double ratio )
+{
+  CountingShape<TShape> shape( aShape, aLow, anUp ), shape2( aShape, aLow, anUp );
+  TDigitalSet set( domain ), set2( domain );
+  Shapes<TDomain>::euclideanShaper( set, shape, h );
+  Shapes<TDomain>::hierarchicalEuclideanShaper( set2, shape2, h );
+  bool ok = ( set.size() == set2.size() ) && ( set.size() > 0 );
+  for ( typename TDigitalSet::ConstIterator it = set.begin(), itend = set.end();
+        ok && ( it != itend ); ++it )
+    ok = ( set2.find( *it ) != set2.end() );
+  trace.info() << set.size() << " points, h=" << h << ", "
+               << shape2.myCount << " evaluations instead of "
+               << shape.myCount << std::endl;
+  return ok && ( shape2.myCount < ratio * shape.myCount );
+}
+
+bool testHierarchicalShaper()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing hierarchical shapers ..." );
+  typedef Z2i::Space::RealPoint RealPoint2;
+  Z2i::Domain domain2( Z2i::Point( -200, -200 ), Z2i::Point( 200, 200 ) );
+  nbok += checkHierarchicalShaper<Z2i::Domain, Z2i::DigitalSet>
+    ( domain2, ImplicitBall<Z2i::Space>( RealPoint2( 0.3, 0.1 ), 40 ),
+      RealPoint2( -41, -41 ), RealPoint2( 41, 41 ), 0.5, 0.3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D ball" << std::endl;
+  nbok += checkHierarchicalShaper<Z2i::Domain, Z2i::DigitalSet>
+    ( domain2, ImplicitHyperCube<Z2i::Space>( RealPoint2( 0.5, -0.25 ), 30 ),
+      RealPoint2( -31, -31 ), RealPoint2( 31, 31 ), 0.3, 0.3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D cube" << std::endl;
+
+  typedef Z3i::Space::RealPoint RealPoint3;
+  Z3i::Domain domain3( Z3i::Point( -40, -40, -40 ), Z3i::Point( 40, 40, 40 ) );
+  nbok += checkHierarchicalShaper<Z3i::Domain, Z3i::DigitalSet>
+    ( domain3, ImplicitRoundedHyperCube<Z3i::Space>( RealPoint3( 0.2, 0, 0.5 ), 10, 2.5 ),
+      RealPoint3( -11, -11, -11 ), RealPoint3( 11, 11, 11 ), 0.3, 0.3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D rounded cube" << std::endl;
+
+  // 1 - x^4 - y^4 - z^4 + x y z
+  typedef ImplicitPolynomial3Shape<Z3i::Space> PolynomialShape;
+  PolynomialShape::Polynomial3 P = mmonomial<double>( 0, 0, 0 ) - mmonomial<double>( 4, 0, 0 )
+    - mmonomial<double>( 0, 4, 0 ) - mmonomial<double>( 0, 0, 4 )
+    + mmonomial<double>( 1, 1, 1 );
+  nbok += checkHierarchicalShaper<Z3i::Domain, Z3i::DigitalSet>
+    ( domain3, PolynomialShape( P ),
+      RealPoint3( -1.5, -1.5, -1.5 ), RealPoint3( 1.5, 1.5, 1.5 ), 0.05, 0.5 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D polynomial" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -164,7 +332,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testImplicitShape() && testImplicitShape3D(); // && ... other tests
+  bool res = testImplicitShape() && testImplicitShape3D()
+    && testParallelShaper() && testHierarchicalShaper(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,173 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConstImageEvaluation.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/20
+ *
+ * Functions for testing the fused evaluation of image expressions.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/BinaryConstImageAdapter.h"
+#include "DGtal/images/ConstImageEvaluation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the fused evaluation of image expressions.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return 'true' if @a aImg and @a aRef have the same values
+ * at each point of the domain of @a aImg.
+ */
+template <typename Image, typename RefImage>
+bool sameValues( const Image & aImg, const RefImage & aRef )
+{
+  typename Image::Domain d = aImg.domain();
+  for ( typename Image::Domain::ConstIterator it = d.begin(), itEnd = d.end();
+        it != itEnd; ++it )
+    if ( aImg( *it ) != aRef( *it ) )
+      return false;
+  return true;
+}
+
+bool testConstImageEvaluation()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing fused evaluation ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  typedef ImageContainerBySTLMap<Z3i::Domain, int> MapImage;
+  Z3i::Domain domain( Z3i::Point( -3, 1, 0 ), Z3i::Point( 12, 9, 7 ) );
+  Image img1( domain ), img2( domain );
+  MapImage mapImg( domain, 0 );
+  int i = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it, ++i )
+    {
+      img1.setValue( *it, ( i * 7 ) % 101 );
+      img2.setValue( *it, ( i * 13 ) % 89 );
+      mapImg.setValue( *it, ( i * 3 ) % 17 );
+    }
+
+  //|img1 - img2| <= 20
+  typedef BinaryConstImageAdapter<Image, Image, MinusFunctor<int>, int> Difference;
+  MinusFunctor<int> minus;
+  Difference diff( img1, img2, minus );
+  typedef ConstImageAdapter<Difference, AbsFunctor<int>, int> AbsDifference;
+  AbsFunctor<int> abs;
+  AbsDifference absDiff( diff, abs );
+  typedef ConstImageAdapter<AbsDifference, Thresholder<int>, bool> Mask;
+  Thresholder<int> t( 20 );
+  Mask mask( absDiff, t );
+
+  Image res( domain );
+  imageFromConstImage( res, absDiff, 10 );
+  nbok += sameValues( res, absDiff ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "aligned expression, small tiles" << std::endl;
+
+  ImageContainerBySTLVector<Z3i::Domain, bool> resMask( domain );
+  imageFromConstImage( resMask, mask );
+  nbok += sameValues( resMask, mask ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "aligned expression, bool values" << std::endl;
+
+  //mixed with an image read point by point
+  typedef BinaryConstImageAdapter<AbsDifference, MapImage, MinusFunctor<int>, int> Mixed;
+  Mixed mixed( absDiff, mapImg, minus );
+  imageFromConstImage( res, mixed, 100 );
+  nbok += sameValues( res, mixed ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "expression with a map image" << std::endl;
+
+  //subdomain: the images of the expression are not aligned
+  Z3i::Domain subdomain( Z3i::Point( 0, 2, 1 ), Z3i::Point( 5, 8, 3 ) );
+  Image subRes( subdomain );
+  imageFromConstImage( subRes, absDiff, 7 );
+  nbok += sameValues( subRes, absDiff ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "subdomain" << std::endl;
+
+  //generic destination
+  MapImage mapRes( domain, 0 );
+  imageFromConstImage( mapRes, mixed );
+  nbok += sameValues( mapRes, mixed ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "map destination" << std::endl;
+
+  //copies share the range of the underlying image
+  Mask maskCopy( mask );
+  Mask maskAssigned( mask );
+  maskAssigned = maskCopy;
+  Mask::ConstRange r = maskAssigned.constRange();
+  Image::ConstRange ri = img1.constRange();
+  bool flag = true;
+  Z3i::Domain::ConstIterator itp = domain.begin();
+  for ( Mask::ConstRange::ConstIterator it = r.begin(), itEnd = r.end();
+        it != itEnd; ++it, ++itp )
+    flag = flag && ( *it == mask( *itp ) );
+  nbok += ( flag && ( itp == domain.end() ) && ( ri.begin() != ri.end() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "copies of adapters" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConstImageEvaluation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testConstImageEvaluation(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,186 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPNMReader-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the PGM/PGM3D decoding of PNMReader against a per
+ * value formatted extraction.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/readers/PNMReader.h"
+#include "DGtal/images/ImageSelector.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageSelector < Z2i::Domain, unsigned int>::Type Image2D;
+typedef ImageSelector < Z3i::Domain, unsigned int>::Type Image3D;
+
+/**
+ * Writes a w x h synthetic PGM image, binary (P5) or ASCII (P2).
+ */
+void writePGM( const std::string & aFilename, unsigned int w, unsigned int h,
+               bool ascii )
+{
+  std::ofstream out( aFilename.c_str(), std::ofstream::binary );
+  out << ( ascii ? "P2" : "P5" ) << std::endl
+      << "# synthetic image" << std::endl
+      << w << " " << h << std::endl << "255" << std::endl;
+  for ( unsigned int y = 0; y < h; ++y )
+    for ( unsigned int x = 0; x < w; ++x )
+      {
+        unsigned char c = (unsigned char) ( ( x * x + 3 * y ) % 256 );
+        if ( ascii )
+          out << (unsigned int) c << ( x + 1 == w ? '\n' : ' ' );
+        else
+          out << c;
+      }
+}
+
+/**
+ * Writes a n x n x n synthetic binary PGM3D image (P3D).
+ */
+void writePGM3D( const std::string & aFilename, unsigned int n )
+{
+  std::ofstream out( aFilename.c_str(), std::ofstream::binary );
+  out << "P3D" << std::endl
+      << n << " " << n << " " << n << std::endl << "255" << std::endl;
+  for ( unsigned int z = 0; z < n; ++z )
+    for ( unsigned int y = 0; y < n; ++y )
+      for ( unsigned int x = 0; x < n; ++x )
+        out << (unsigned char) ( ( x + y * z ) % 256 );
+}
+
+/**
+ * Reference decoding: one formatted extraction and one setValue per
+ * pixel, skipping the three header lines written above.
+ */
+template <typename Image>
+Image streamImport( const std::string & aFilename, const typename Image::Point & aUpper,
+                    unsigned int nbHeaderLines, bool ascii )
+{
+  std::ifstream in( aFilename.c_str(), std::ifstream::binary );
+  std::string str;
+  for ( unsigned int i = 0; i < nbHeaderLines; ++i )
+    getline( in, str );
+  typename Image::Domain domain( Image::Point::zero, aUpper );
+  Image image( domain );
+  if ( ascii ) in >> skipws; else in >> noskipws;
+  for ( typename Image::Domain::ConstIterator it = domain.begin(),
+          itend = domain.end(); it != itend; ++it )
+    {
+      if ( ascii )
+        {
+          int c;
+          in >> c;
+          image.setValue( *it, c );
+        }
+      else
+        {
+          unsigned char c;
+          in >> c;
+          image.setValue( *it, c );
+        }
+    }
+  return image;
+}
+
+/**
+ * Times both decoders on a 2D image and prints one result line.
+ */
+bool benchmark2D( unsigned int n, bool ascii )
+{
+  const std::string filename = ascii ? "benchmark-PNMReader.P2.pgm"
+    : "benchmark-PNMReader.P5.pgm";
+  writePGM( filename, n, n, ascii );
+  Clock c;
+
+  c.startClock();
+  Image2D ref = streamImport<Image2D>( filename, Z2i::Point( n-1, n-1 ), 4, ascii );
+  double tRef = c.stopClock();
+
+  c.startClock();
+  Image2D image = PNMReader<Image2D>::importPGM( filename, false );
+  double tBulk = c.stopClock();
+
+  bool ok = std::equal( ref.begin(), ref.end(), image.begin() );
+  std::cout << ( ascii ? "P2 " : "P5 " ) << n << "x" << n << " "
+            << tRef << " " << tBulk << " " << ( ok ? "ok" : "DIFF" ) << std::endl;
+  return ok;
+}
+
+/**
+ * Times both decoders on a 3D image and prints one result line.
+ */
+bool benchmark3D( unsigned int n )
+{
+  const std::string filename = "benchmark-PNMReader.p3d";
+  writePGM3D( filename, n );
+  Clock c;
+
+  c.startClock();
+  Image3D ref = streamImport<Image3D>( filename, Z3i::Point( n-1, n-1, n-1 ), 3, false );
+  double tRef = c.stopClock();
+
+  c.startClock();
+  Image3D image = PNMReader<Image3D>::importPGM3D( filename );
+  double tBulk = c.stopClock();
+
+  bool ok = std::equal( ref.begin(), ref.end(), image.begin() );
+  std::cout << "P3D " << n << "x" << n << "x" << n << " "
+            << tRef << " " << tBulk << " " << ( ok ? "ok" : "DIFF" ) << std::endl;
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class PNMReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  std::cout << "# format size stream-extraction(ms) bulk-decoding(ms) check" << std::endl;
+  bool res = true;
+  for ( unsigned int n = 512; n <= 4096; n *= 2 )
+    res = benchmark2D( n, false ) && benchmark2D( n, true ) && res;
+  for ( unsigned int n = 64; n <= 256; n *= 2 )
+    res = benchmark3D( n ) && res;
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
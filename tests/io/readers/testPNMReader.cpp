@@ -33,7 +33,13 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/io/readers/PNMReader.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
 #include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/io/writers/PNMWriter.h"
+#include "DGtal/io/colormaps/GrayscaleColorMap.h"
+#include <fstream>
+#include <sstream>
+#include <vector>
 #include "ConfigTest.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -75,6 +81,127 @@ bool testPNMReader()
   return nbok == nb;
 }
 
+/**
+ * Checks that the bulk decoding of binary and ASCII PGM/PGM3D files
+ * gives back the exported values.
+ */
+bool testPNMReaderRoundTrip()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;  
+  trace.beginBlock ( "Testing PGM/PGM3D write/read round trip ..." );
+
+  typedef GrayscaleColorMap<unsigned char> Gray;
+  typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image2D;
+  typedef ImageSelector < Z3i::Domain, unsigned char>::Type Image3D;
+
+  Z2i::Domain domain2D( Z2i::Point(0,0), Z2i::Point(36,12) );
+  Image2D image2D( domain2D );
+  unsigned int i = 0;
+  for ( Z2i::Domain::ConstIterator it = domain2D.begin(), 
+          itend = domain2D.end(); it != itend; ++it, ++i )
+    image2D.setValue( *it, (unsigned char) ( (i*7) % 256 ) );
+
+  PNMWriter<Image2D,Gray>::exportPGM( "testPNMReader-binary.pgm", image2D, 0, 255, false );
+  PNMWriter<Image2D,Gray>::exportPGM( "testPNMReader-ascii.pgm", image2D, 0, 255, true );
+  Image2D readBinary = PNMReader<Image2D>::importPGM( "testPNMReader-binary.pgm" );
+  Image2D readASCII = PNMReader<Image2D>::importPGM( "testPNMReader-ascii.pgm" );
+  bool ok2D = true;
+  for ( Z2i::Domain::ConstIterator it = domain2D.begin(), 
+          itend = domain2D.end(); it != itend; ++it )
+    ok2D = ok2D && ( image2D( *it ) == readBinary( *it ) ) 
+      && ( image2D( *it ) == readASCII( *it ) );
+  nbok += ok2D ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P5 and P2 images read back" << std::endl;
+
+  Z3i::Domain domain3D( Z3i::Point(0,0,0), Z3i::Point(9,6,4) );
+  Image3D image3D( domain3D );
+  std::ofstream out( "testPNMReader-binary.p3d", std::ofstream::binary );
+  out << "P3D" << std::endl << "# comment" << std::endl 
+      << "10 7 5" << std::endl << "255" << std::endl;
+  i = 0;
+  for ( Z3i::Domain::ConstIterator it = domain3D.begin(), 
+          itend = domain3D.end(); it != itend; ++it, ++i )
+    {
+      image3D.setValue( *it, (unsigned char) ( (i*13) % 256 ) );
+      out << image3D( *it );
+    }
+  out.close();
+  PNMWriter<Image3D,Gray>::exportPGM3D( "testPNMReader-ascii.pgm3d", image3D, 0, 255 );
+  Image3D readBinary3D = PNMReader<Image3D>::importPGM3D( "testPNMReader-binary.p3d" );
+  Image3D readASCII3D = PNMReader<Image3D>::importPGM3D( "testPNMReader-ascii.pgm3d" );
+  bool ok3D = true;
+  for ( Z3i::Domain::ConstIterator it = domain3D.begin(), 
+          itend = domain3D.end(); it != itend; ++it )
+    ok3D = ok3D && ( image3D( *it ) == readBinary3D( *it ) ) 
+      && ( image3D( *it ) == readASCII3D( *it ) );
+  nbok += ok3D ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P3D and P2-3D images read back" << std::endl;
+
+  // Images other than ImageContainerBySTLVector are filled point by point.
+  typedef ImageContainerBySTLMap<Z2i::Domain, unsigned char> MapImage2D;
+  MapImage2D readBinaryMap = PNMReader<MapImage2D>::importPGM( "testPNMReader-binary.pgm" );
+  MapImage2D readASCIIMap = PNMReader<MapImage2D>::importPGM( "testPNMReader-ascii.pgm" );
+  bool okMap = true;
+  for ( Z2i::Domain::ConstIterator it = domain2D.begin(), 
+          itend = domain2D.end(); it != itend; ++it )
+    okMap = okMap && ( image2D( *it ) == readBinaryMap( *it ) ) 
+      && ( image2D( *it ) == readASCIIMap( *it ) );
+  nbok += okMap ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P5 and P2 images read back in a map image" << std::endl;
+
+  std::ofstream truncated( "testPNMReader-truncated.pgm" );
+  truncated << "P2" << std::endl << "3 2" << std::endl << "255" << std::endl 
+            << "1 2 3 # comment" << std::endl << "4 5" << std::endl;
+  truncated.close();
+  bool hasThrown = false;
+  try 
+    {
+      PNMReader<Image2D>::importPGM( "testPNMReader-truncated.pgm" );
+    }
+  catch ( DGtal::IOException & )
+    {
+      hasThrown = true;
+    }
+  nbok += hasThrown ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "truncated P2 image rejected" << std::endl;
+
+  std::istringstream values( "1 2\n# 9 9\n3 4 trailing" );
+  std::vector<unsigned int> buffer;
+  bool okStop = PNMReader<Image2D>::readASCIIValues( values, buffer, 4, 255 );
+  std::string rest;
+  values >> rest;
+  okStop = okStop && ( buffer.size() == 4 ) && ( buffer[ 2 ] == 3 )
+    && ( buffer[ 3 ] == 4 ) && ( rest == "trailing" );
+  nbok += okStop ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "ASCII decoding stops after the last value" << std::endl;
+
+  std::istringstream tooLarge( "1 256 3" );
+  std::istringstream overflow( "1 99999999999999999999 3" );
+  buffer.clear();
+  bool okMax = ! PNMReader<Image2D>::readASCIIValues( tooLarge, buffer, 3, 255 );
+  buffer.clear();
+  okMax = okMax 
+    && ! PNMReader<Image2D>::readASCIIValues( overflow, buffer, 3, 4294967295u );
+  nbok += okMax ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "values above maxval rejected" << std::endl;
+
+  trace.endBlock();  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -86,7 +213,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testPNMReader(); // && ... other tests
+  bool res = testPNMReader() && testPNMReaderRoundTrip(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -33,6 +33,12 @@
 #include "DGtal/io/readers/PointListReader.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/curves/representation/FreemanChain.h" 
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
+#include <fstream>
+#include <iterator>
+#include <clocale>
+#include <locale>
+#include <stdexcept>
 
 #include "ConfigTest.h"
 
@@ -82,6 +88,177 @@ bool testPointListReader()
   return nbok == nb;
 }
 
+/**
+ * Checks that the buffered and chunked parsing gives the same points
+ * as the stream based one.
+ */
+bool testPointListReaderChunks()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing chunked point list parsing ..." );
+  std::string filename = testPath + "samples/sinus3D.dat";
+  std::ifstream infile( filename.c_str() );
+  vector<Z3i::Point> ref = PointListReader<Z3i::Point>::getPointsFromInputStream( infile );
+  vector<Z3i::Point> vectPoints = PointListReader<Z3i::Point>::getPointsFromFile( filename );
+  nbok += ( ref.size() > 0 && vectPoints == ref ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << ref.size() << " points read from file" << std::endl;
+
+  std::string content = "# header\n1 2 3\n\n-4\t5 6.5 7\n+8 9 x 10\n11 12 13";
+  std::istringstream in( content + "\n" );
+  vector<Z2i::Point> ref2 = PointListReader<Z2i::Point>::getPointsFromInputStream( in );
+  bool ok = true;
+  for ( unsigned int k = 1; k < 8; ++k )
+    {
+      vector<Z2i::Point> chunked;
+      PointListReader<Z2i::Point>::copyPointsFromBuffer( content.data(), 
+                                                         content.data() + content.size(),
+                                                         std::back_inserter( chunked ),
+                                                         std::vector<unsigned int>(), k );
+      ok = ok && ( chunked == ref2 );
+    }
+  nbok += ( ok && ref2.size() == 4 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << "integer points parsed in 1 to 7 chunks" << std::endl;
+
+  std::vector<unsigned int> vectPos;
+  vectPos.push_back( 2 );
+  vectPos.push_back( 0 );
+  std::istringstream inReal( content + "\n" );
+  vector<Z2i::Space::RealPoint> refReal = 
+    PointListReader<Z2i::Space::RealPoint>::getPointsFromInputStream( inReal, vectPos );
+  vector<Z2i::Space::RealPoint> chunkedReal;
+  PointListReader<Z2i::Space::RealPoint>::copyPointsFromBuffer( content.data(), 
+                                                         content.data() + content.size(),
+                                                         std::back_inserter( chunkedReal ),
+                                                         vectPos, 3 );
+  nbok += ( chunkedReal == refReal && refReal.size() == 3 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << "real points with selected columns" << std::endl;
+
+  // Unlike the stream based reader, the buffer parser keeps a last
+  // line without end of line.
+  std::string noEol = "1 2\n3 4";
+  std::istringstream inNoEol( noEol );
+  vector<Z2i::Point> chunkedNoEol;
+  PointListReader<Z2i::Point>::copyPointsFromBuffer( noEol.data(), 
+                                                     noEol.data() + noEol.size(),
+                                                     std::back_inserter( chunkedNoEol ) );
+  nbok += ( PointListReader<Z2i::Point>::getPointsFromInputStream( inNoEol ).size() == 1
+            && chunkedNoEol.size() == 2 && chunkedNoEol[ 1 ] == Z2i::Point( 3, 4 ) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << "last line without end of line" << std::endl;
+
+  // Long mantissas, extreme exponents and overflows give the same
+  // results as the stream extraction.
+  std::string extreme = 
+    "0.12345678901234567890123 9.8765432109876543210e-300\n"
+    "2.2250738585072014e-308 123456789012345678901234567890.5\n"
+    "1e999999999 5\n"
+    "7 -1e-999999999\n"
+    "99999999999 1\n"
+    "2147483647 -2147483648\n";
+  std::istringstream inExtremeReal( extreme );
+  std::istringstream inExtremeInt( extreme );
+  vector<Z2i::Space::RealPoint> refExtremeReal = 
+    PointListReader<Z2i::Space::RealPoint>::getPointsFromInputStream( inExtremeReal );
+  vector<Z2i::Point> refExtremeInt = 
+    PointListReader<Z2i::Point>::getPointsFromInputStream( inExtremeInt );
+  vector<Z2i::Space::RealPoint> chunkedExtremeReal;
+  vector<Z2i::Point> chunkedExtremeInt;
+  PointListReader<Z2i::Space::RealPoint>::copyPointsFromBuffer( extreme.data(), 
+                                                         extreme.data() + extreme.size(),
+                                                         std::back_inserter( chunkedExtremeReal ) );
+  PointListReader<Z2i::Point>::copyPointsFromBuffer( extreme.data(), 
+                                                     extreme.data() + extreme.size(),
+                                                     std::back_inserter( chunkedExtremeInt ) );
+  nbok += ( chunkedExtremeReal == refExtremeReal && refExtremeReal.size() == 5
+            && chunkedExtremeInt == refExtremeInt && refExtremeInt.size() == 2 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << "correctly rounded reals and integer overflows" << std::endl;
+
+  // Usual decimals give the same results as the stream extraction in
+  // the classic locale, even under a comma-decimal C locale (when one
+  // is installed).
+  std::string decimals = 
+    "0.1 1.5e3\n3.14159 -2.5e-7\n.5 7.\n1234567.0625 -0.000001\n";
+  std::istringstream inDecimals( decimals );
+  inDecimals.imbue( std::locale::classic() );
+  vector<Z2i::Space::RealPoint> refDecimals = 
+    PointListReader<Z2i::Space::RealPoint>::getPointsFromInputStream( inDecimals );
+  const std::string previousLocale = setlocale( LC_NUMERIC, 0 );
+  const char * commaLocales[] = { "de_DE.UTF-8", "fr_FR.UTF-8", "de_DE", "fr_FR" };
+  for ( unsigned int i = 0; i < 4; ++i )
+    if ( setlocale( LC_NUMERIC, commaLocales[ i ] ) != 0 ) break;
+  trace.info() << "LC_NUMERIC=" << setlocale( LC_NUMERIC, 0 ) << std::endl;
+  vector<Z2i::Space::RealPoint> chunkedDecimals;
+  PointListReader<Z2i::Space::RealPoint>::copyPointsFromBuffer( decimals.data(), 
+                                                         decimals.data() + decimals.size(),
+                                                         std::back_inserter( chunkedDecimals ) );
+  setlocale( LC_NUMERIC, previousLocale.c_str() );
+  nbok += ( chunkedDecimals == refDecimals && refDecimals.size() == 4 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << "decimals independent of the locale" << std::endl;
+
+  // 64-bit coordinates are range checked in 64 bits.
+  typedef PointVector<2, DGtal::int64_t> Point64;
+  std::string large = 
+    "4000000000 -9223372036854775808\n"
+    "9223372036854775807 -1\n"
+    "9223372036854775808 2\n"
+    "-9223372036854775809 3\n";
+  vector<Point64> chunkedLarge;
+  PointListReader<Point64>::copyPointsFromBuffer( large.data(), 
+                                                  large.data() + large.size(),
+                                                  std::back_inserter( chunkedLarge ) );
+  nbok += ( chunkedLarge.size() == 2 
+            && chunkedLarge[ 0 ][ 0 ] == (DGtal::int64_t) 4000000000LL
+            && chunkedLarge[ 0 ][ 1 ] == std::numeric_limits<DGtal::int64_t>::min()
+            && chunkedLarge[ 1 ][ 0 ] == std::numeric_limits<DGtal::int64_t>::max()
+            && chunkedLarge[ 1 ][ 1 ] == -1 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << "64-bit coordinates" << std::endl;
+
+  // Too few positions are detected before parsing.
+  bool thrown = false;
+  try 
+    {
+      vector<Z2i::Point> unused;
+      PointListReader<Z2i::Point>::copyPointsFromBuffer( content.data(), 
+                                                         content.data() + content.size(),
+                                                         std::back_inserter( unused ),
+                                                         std::vector<unsigned int>( 1, 0 ) );
+    }
+  catch ( std::out_of_range & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << "too few positions" << std::endl;
+
+  Z3i::Domain domain( Z3i::Point( -100, -100, -100 ), Z3i::Point( 100, 100, 100 ) );
+  Z3i::DigitalSet set( domain );
+  DigitalSetInserter<Z3i::DigitalSet> inserter( set );
+  unsigned int nbRead = PointListReader<Z3i::Point>::copyPointsFromFile( filename, inserter );
+  nbok += ( nbRead == ref.size() && set.size() > 0 && set.size() <= ref.size() ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << set.size() << " points inserted in a digital set" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -94,7 +271,7 @@ int main( int argc, char** argv )
   trace.info() << endl;
   
   
-  bool res = testPointListReader(); // && ... other tests
+  bool res = testPointListReader() && testPointListReaderChunks(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,159 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBlockWriter.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/19
+ *
+ * Functions for testing class BlockWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/io/colormaps/GrayscaleColorMap.h"
+#include "DGtal/io/colormaps/HueShadeColorMap.h"
+#include "DGtal/io/writers/BlockWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BlockWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Reference export: one colormap call and one stream write per point.
+ */
+template <typename Image, typename Colormap, typename Word>
+std::string referenceExport( const Image & aImage, const Colormap & aColormap )
+{
+  std::ostringstream out;
+  for ( typename Image::Domain::ConstIterator it = aImage.domain().begin(),
+          itend = aImage.domain().end(); it != itend; ++it )
+    {
+      Color col = aColormap( aImage( *it ) );
+      Word value = (Word) ( ( (int)col.red() + (int)col.green() + (int)col.blue() ) / 3 );
+      for ( unsigned size = sizeof( Word ); size; --size, value >>= 8 )
+        out.put( static_cast<char>( value & 0xFF ) );
+    }
+  return out.str();
+}
+
+/**
+ * Compares the block export with the reference one, for several block
+ * sizes, in synchronous and asynchronous modes.
+ */
+template <typename Image, typename Colormap, typename Word>
+bool compareExports( const Image & aImage, const Colormap & aColormap )
+{
+  const std::string ref = referenceExport<Image, Colormap, Word>( aImage, aColormap );
+  bool ok = true;
+  for ( std::size_t blockSize = 1; blockSize < 2000; blockSize = 3 * blockSize + 1 )
+    for ( unsigned int async = 0; async < 2; ++async )
+      {
+        std::ostringstream out;
+        ok = ok && BlockWriter<Image, Colormap>::template exportWords<Word>
+          ( out, aImage, aColormap, blockSize, async == 1 );
+        ok = ok && ( out.str() == ref );
+      }
+  return ok;
+}
+
+bool testBlockWriter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing block export ..." );
+
+  Z3i::Domain domain( Z3i::Point( -2, 0, 1 ), Z3i::Point( 9, 7, 6 ) );
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned int> Image;
+  typedef ImageContainerBySTLMap<Z3i::Domain, unsigned int> MapImage;
+  typedef GrayscaleColorMap<unsigned int> Gray;
+  typedef HueShadeColorMap<unsigned int> Hue;
+  Image image( domain );
+  MapImage mapImage( domain );
+  unsigned int i = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it, ++i )
+    {
+      image.setValue( *it, ( i * 37 ) % 1000 );
+      mapImage.setValue( *it, ( i * 37 ) % 1000 );
+    }
+
+  nbok += compareExports<Image, Gray, unsigned char>( image, Gray( 0, 999 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vector image, grayscale, 8 bits" << std::endl;
+  nbok += compareExports<Image, Gray, DGtal::uint64_t>( image, Gray( 0, 999 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vector image, grayscale, 64 bits" << std::endl;
+  nbok += compareExports<Image, Hue, unsigned char>( image, Hue( 0, 999 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vector image, hue shade, 8 bits" << std::endl;
+  nbok += compareExports<MapImage, Gray, unsigned char>( mapImage, Gray( 0, 999 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "map image, grayscale, 8 bits" << std::endl;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, bool> BoolImage;
+  typedef GrayscaleColorMap<bool> BoolGray;
+  BoolImage boolImage( domain );
+  i = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it, ++i )
+    boolImage.setValue( *it, ( i * 37 ) % 3 == 0 );
+  nbok += compareExports<BoolImage, BoolGray, unsigned char>( boolImage, BoolGray( false, true ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vector image of bool, grayscale, 8 bits" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BlockWriter" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBlockWriter(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
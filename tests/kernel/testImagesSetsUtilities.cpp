@@ -221,6 +221,103 @@ bool testSetFromImage()
   return nbok == nb;
 }
 
+/**
+ * Compares the contiguous scans of ImageContainerBySTLVector
+ * with the point by point scans of ImageContainerBySTLMap.
+ */
+template <typename Space>
+bool testSpanScans(const typename Space::Point& a, const typename Space::Point& b)
+{
+  typedef HyperRectDomain<Space> Domain; 
+  typedef typename Space::Point Point; 
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  typedef ImageContainerBySTLVector<Domain,int> VImage; 
+  typedef ImageContainerBySTLMap<Domain,int> MImage; 
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing span scans ..." );
+
+  Domain d(a,b); 
+  VImage vImage(d); 
+  MImage mImage(d, 0); 
+  Norm1<Point> n; 
+  imageFromFunctor(vImage, n); 
+  imageFromFunctor(mImage, n); 
+  bool flag = true; 
+  for (typename Domain::ConstIterator it = d.begin(), itEnd = d.end(); 
+       it != itEnd; ++it)
+    flag = flag && (vImage(*it) == (int)(*it).norm1()) 
+      && (mImage(*it) == vImage(*it)); 
+  nbok += flag ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") imageFromFunctor" << std::endl;
+
+  const int t = (int) ( (b - a).norm1() / 2 + a.norm1() ); 
+  DigitalSet vSet(d), mSet(d); 
+  DigitalSetInserter<DigitalSet> vInserter(vSet), mInserter(mSet); 
+  setFromImage( vImage, vInserter, t ); 
+  setFromImage( mImage, mInserter, t ); 
+  nbok += ( (vSet.size() == mSet.size()) && (vSet.size() > 0) && (vSet.size() < d.size())
+	    && std::equal(vSet.begin(), vSet.end(), mSet.begin()) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") setFromImage (threshold)" << std::endl;
+
+  DigitalSet vSet2(d), mSet2(d); 
+  DigitalSetInserter<DigitalSet> vInserter2(vSet2), mInserter2(mSet2); 
+  setFromImage( vImage, vInserter2, t - 2, t + 1 ); 
+  setFromImage( mImage, mInserter2, t - 2, t + 1 ); 
+  nbok += ( (vSet2.size() == mSet2.size()) && (vSet2.size() > 0)
+	    && std::equal(vSet2.begin(), vSet2.end(), mSet2.begin()) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") setFromImage (interval)" << std::endl;
+
+  DigitalSet vSet3(d), mSet3(d); 
+  SetFromImage<DigitalSet>::template append<VImage>(vSet3, vImage, t - 2, t + 1); 
+  //reference: point by point predicate
+  IntervalForegroundPredicate<VImage> isForeground(vImage, t - 2, t + 1); 
+  SetFromImage<DigitalSet>::template append<VImage>(mSet3, isForeground, d.begin(), d.end()); 
+  nbok += ( (vSet3.size() == mSet3.size()) && (vSet3.size() > 0)
+	    && std::equal(vSet3.begin(), vSet3.end(), mSet3.begin()) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") SetFromImage::append" << std::endl;
+
+  VImage vImage2(d); 
+  imageFromImage(vImage2, vImage); 
+  fillImage(vImage, 3); 
+  fillImage(mImage, 3); 
+  flag = true; 
+  for (typename Domain::ConstIterator it = d.begin(), itEnd = d.end(); 
+       it != itEnd; ++it)
+    flag = flag && (vImage(*it) == 3) && (mImage(*it) == 3) 
+      && (vImage2(*it) == (int)(*it).norm1()); 
+  nbok += flag ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") imageFromImage and fillImage" << std::endl;
+
+  //std::vector<bool> storage, scanned through iterators
+  typedef ImageContainerBySTLVector<Domain,bool> BImage; 
+  typedef ImageContainerBySTLMap<Domain,bool> BMImage; 
+  BImage bImage(d), bImage2(d); 
+  BMImage bmImage(d, false); 
+  fillImage(bImage, true); 
+  imageFromImage(bImage2, bImage); 
+  fillImage(bmImage, true); 
+  DigitalSet bSet(d), bmSet(d); 
+  DigitalSetInserter<DigitalSet> bInserter(bSet), bmInserter(bmSet); 
+  setFromImage( bImage2, bInserter, false, true ); 
+  setFromImage( bmImage, bmInserter, false, true ); 
+  nbok += ( (bSet.size() == bmSet.size()) && (bSet.size() == d.size())
+	    && std::equal(bSet.begin(), bSet.end(), bmSet.begin()) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") images of bool" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -232,7 +329,9 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testImageFromSet() && testSetFromImage();
+  bool res = testImageFromSet() && testSetFromImage()
+    && testSpanScans<Z2i::Space>( Z2i::Point(-3,2), Z2i::Point(17,9) )
+    && testSpanScans<Z3i::Space>( Z3i::Point(1,-4,0), Z3i::Point(6,2,5) );
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
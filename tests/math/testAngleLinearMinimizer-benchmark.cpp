@@ -0,0 +1,145 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testAngleLinearMinimizer-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/07/03
+ *
+ * Benchmark of the iterations of AngleLinearMinimizer by optimize()
+ * and by optimizeSweeps(), on the tangent directions of a long noisy
+ * closed curve.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/math/AngleLinearMinimizer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class AngleLinearMinimizer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Tangent directions of a noisy circle of [n] points, each one being
+ * allowed to move by 0.2 radian.
+ */
+void initNoisyCircle( AngleLinearMinimizer & alm, unsigned int n )
+{
+  srand( 0 );
+  alm.init( n );
+  alm.setIsCurveOpen( false );
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      AngleLinearMinimizer::ValueInfo & vi = alm.rw( i );
+      double noise = 0.4 * ( rand() / (double) RAND_MAX ) - 0.2;
+      double val = AngleComputer::cast( 2.0 * M_PI * i / n + M_PI / 2.0 + noise );
+      vi.value = val;
+      vi.oldValue = val;
+      vi.min = AngleComputer::cast( val - 0.2 );
+      vi.max = AngleComputer::cast( val + 0.2 );
+      vi.distToNext = 1.0 + ( i % 3 ) * 0.5;
+    }
+}
+
+/**
+ * Performs [nbIterations] iterations by optimize() and by
+ * optimizeSweeps() (with 1 and all threads) on two minimizers of the
+ * same type.
+ */
+template <typename Minimizer>
+bool benchmarkMinimizer( const string & name, unsigned int n, 
+                         unsigned int nbIterations )
+{
+  trace.beginBlock( "Benchmarking " + name );
+  Minimizer alm1, alm2, alm3;
+  initNoisyCircle( alm1, n );
+  initNoisyCircle( alm2, n );
+  initNoisyCircle( alm3, n );
+
+  Clock clock;
+  clock.startClock();
+  for ( unsigned int i = 0; i < nbIterations; ++i )
+    alm1.optimize();
+  double t1 = clock.stopClock();
+  clock.startClock();
+  alm2.optimizeSweeps( 0.0, nbIterations );
+  double t2 = clock.stopClock();
+  clock.startClock();
+  alm3.optimizeSweeps( 0.0, nbIterations, false, 0 );
+  double t3 = clock.stopClock();
+
+  double d = 0.0;
+  for ( unsigned int i = 0; i < n; ++i )
+    d = max( d, fabs( AngleComputer::deviation( alm1.ro( i ).value,
+                                                alm2.ro( i ).value ) ) );
+  trace.info() << n << " values, " << nbIterations << " iterations: optimize " 
+               << t1 << " ms, optimizeSweeps " << t2 << " ms, " 
+               << t3 << " ms (all threads)" << std::endl;
+  trace.info() << "last displacements " << alm1.sum() << " / " << alm2.sum()
+               << ", max deviation " << d << std::endl;
+
+  // convergence on a shorter curve, with energies.
+  Minimizer alm4;
+  initNoisyCircle( alm4, n / 10 );
+  clock.startClock();
+  unsigned int nb = alm4.optimizeSweeps( 0.001, 1000000, true, 0 );
+  double t4 = clock.stopClock();
+  const std::vector<AngleLinearMinimizer::IterationInfo> & its = alm4.iterations();
+  trace.info() << "convergence of " << n / 10 << " values (sum <= 0.001): " 
+               << nb << " iterations, " << t4 << " ms" << std::endl;
+  for ( unsigned int i = 1; i <= nb; i *= 4 )
+    trace.info() << "iteration " << i << ": sum " << its[ i - 1 ].sum
+                 << " max " << its[ i - 1 ].max 
+                 << " energy " << its[ i - 1 ].energy << std::endl;
+  trace.endBlock();
+  return alm2.sum() == alm3.sum();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class AngleLinearMinimizer" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkMinimizer<AngleLinearMinimizer>
+    ( "standard minimizer", 100000, 200 )
+    && benchmarkMinimizer<AngleLinearMinimizerByRelaxation>
+    ( "relaxation", 100000, 200 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/AngleLinearMinimizer.h"
 #include "DGtal/io/boards/Board2D.h"
@@ -102,6 +105,150 @@ bool testAngleLinearMinimizer()
 
 
 
+/**
+ * Tangent directions of a noisy circle of [n] points, each one being
+ * allowed to move by 0.2 radian.
+ */
+void initNoisyCircle( AngleLinearMinimizer & alm, unsigned int n, bool open )
+{
+  srand( 0 );
+  alm.init( n );
+  alm.setIsCurveOpen( open );
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      AngleLinearMinimizer::ValueInfo & vi = alm.rw( i );
+      double noise = 0.4 * ( rand() / (double) RAND_MAX ) - 0.2;
+      double val = AngleComputer::cast( 2.0 * M_PI * i / n + M_PI / 2.0 + noise );
+      vi.value = val;
+      vi.oldValue = val;
+      vi.min = AngleComputer::cast( val - 0.2 );
+      vi.max = AngleComputer::cast( val + 0.2 );
+      vi.distToNext = 1.0 + ( i % 3 ) * 0.5;
+    }
+}
+
+/**
+ * @return the max of the absolute deviations between the values of
+ * the two minimizers.
+ */
+double maxDeviation( const AngleLinearMinimizer & alm1, 
+                     const AngleLinearMinimizer & alm2 )
+{
+  double d = 0.0;
+  for ( unsigned int i = 0; i < alm1.size(); ++i )
+    d = std::max( d, fabs( AngleComputer::deviation( alm1.ro( i ).value,
+                                                     alm2.ro( i ).value ) ) );
+  return d;
+}
+
+/**
+ * @return the energy of the system, including the term between the
+ * last and the first values when the curve is closed.
+ */
+double energy( const AngleLinearMinimizer & alm, bool open )
+{
+  double E = alm.getEnergy( 0, 0 );
+  if ( ! open )
+    {
+      const AngleLinearMinimizer::ValueInfo & vlast = alm.ro( alm.size() - 1 );
+      double dev = AngleComputer::deviation( alm.ro( 0 ).value, vlast.value );
+      E += ( dev * dev ) / vlast.distToNext;
+    }
+  return E;
+}
+
+/**
+ * Iterates optimize() as in the [optimization] snippet.
+ * @return the number of iterations.
+ */
+unsigned int optimizeLoop( AngleLinearMinimizer & alm, double epsilon )
+{
+  unsigned int nb = 1;
+  double delta = alm.optimize();
+  while ( delta > epsilon )
+    {
+      delta = alm.optimize();
+      ++nb;
+    }
+  return nb;
+}
+
+bool testAngleLinearMinimizerSweeps()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing AngleLinearMinimizer::optimizeSweeps ." );
+  const double epsilon = 0.0001;
+  for ( int open = 0; open < 2; ++open )
+    {
+      AngleLinearMinimizer alm1, alm2, alm3;
+      initNoisyCircle( alm1, 201, open == 1 );
+      initNoisyCircle( alm2, 201, open == 1 );
+      initNoisyCircle( alm3, 201, open == 1 );
+      unsigned int nb1 = optimizeLoop( alm1, epsilon );
+      unsigned int nb2 = alm2.optimizeSweeps( epsilon, 100000, true );
+      unsigned int nb3 = alm3.optimizeSweeps( epsilon, 100000, false, 0 );
+      const std::vector<AngleLinearMinimizer::IterationInfo> & its 
+        = alm2.iterations();
+      double E = energy( alm1, open == 1 );
+      trace.info() << "standard: " << nb1 << " iterations (optimize), " 
+                   << nb2 << " iterations (sweeps), energy " 
+                   << E << " / " << its.back().energy 
+                   << ", max deviation " << maxDeviation( alm1, alm2 ) 
+                   << std::endl;
+      nbok += ( nb1 == nb2 ) && ( nb2 == nb3 ) && ( its.size() == nb2 )
+        && ( maxDeviation( alm1, alm2 ) < 1e-9 ) 
+        && ( maxDeviation( alm2, alm3 ) == 0.0 )
+        && ( fabs( its.back().energy - E ) < 1e-9 * E )
+        && ( fabs( its.back().sum - alm1.sum() ) < 1e-9 ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "optimizeSweeps == optimize" << std::endl;
+
+      AngleLinearMinimizerByRelaxation almr1, almr2;
+      initNoisyCircle( almr1, 201, open == 1 );
+      initNoisyCircle( almr2, 201, open == 1 );
+      nb1 = optimizeLoop( almr1, epsilon );
+      nb2 = almr2.optimizeSweeps( epsilon, 100000, true, 0 );
+      const std::vector<AngleLinearMinimizer::IterationInfo> & itsr 
+        = almr2.iterations();
+      E = energy( almr1, open == 1 );
+      bool decreasing = true;
+      for ( unsigned int i = 1; i < itsr.size(); ++i )
+        decreasing = decreasing 
+          && ( itsr[ i ].energy <= itsr[ i - 1 ].energy + 1e-12 );
+      trace.info() << "relaxation: " << nb1 << " iterations (optimize), " 
+                   << nb2 << " iterations (red-black sweeps), energy " 
+                   << E << " / " << itsr.back().energy 
+                   << ", max deviation " << maxDeviation( almr1, almr2 ) 
+                   << std::endl;
+      nbok += decreasing 
+        && ( maxDeviation( almr1, almr2 ) < 1e-3 )
+        && ( fabs( itsr.back().energy - E ) < 1e-4 * E ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "red-black relaxation == relaxation" << std::endl;
+
+      AngleLinearMinimizerByGradientDescent almg( 0.1 );
+      initNoisyCircle( almg, 201, open == 1 );
+      double E0 = energy( almg, open == 1 );
+      nb2 = almg.optimizeSweeps( epsilon, 100000, true );
+      trace.info() << "gradient descent: " << nb2 << " iterations, energy " 
+                   << E0 << " -> " << almg.iterations().back().energy 
+                   << ", max deviation to relaxation " 
+                   << maxDeviation( almr1, almg ) << std::endl;
+      nbok += ( almg.iterations().back().energy < E0 ) 
+        && ( fabs( energy( almg, open == 1 ) 
+                   - almg.iterations().back().energy ) < 1e-9 * E0 ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "gradient descent sweeps decrease the energy" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -113,7 +260,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testAngleLinearMinimizer(); // && ... other tests
+  bool res = testAngleLinearMinimizer() 
+    && testAngleLinearMinimizerSweeps(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,193 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMPolynomial-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/29
+ *
+ * Benchmark of the evaluation of the value and gradient of
+ * 3-polynomials, by curried evaluation of MPolynomial and by
+ * MPolynomialProgram, on the surfaces of
+ * trackImplicitPolynomialSurfaceToOFF.cpp.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/MPolynomialProgram.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef MPolynomial<3, double> Polynomial3;
+typedef MPolynomialProgram<3, double> Program3;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class MPolynomialProgram.
+///////////////////////////////////////////////////////////////////////////////
+
+bool benchmarkMPolynomialProgram( const string & poly_str, double step )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Benchmarking evaluation of " + poly_str );
+  Polynomial3 P;
+  MPolynomialReader<3, double> reader;
+  if ( reader.read( P, poly_str.begin(), poly_str.end() ) != poly_str.end() )
+    {
+      trace.error() << "Unable to read " << poly_str << std::endl;
+      trace.endBlock();
+      return false;
+    }
+  Polynomial3 D[ 3 ] =
+    { derivative<0>( P ), derivative<1>( P ), derivative<2>( P ) };
+
+  //grid points of [-2,2]^3, one array per coordinate
+  vector<double> coords[ 3 ];
+  for ( double x = -2.0; x < 2.0; x += step )
+    for ( double y = -2.0; y < 2.0; y += step )
+      for ( double z = -2.0; z < 2.0; z += step )
+        {
+          coords[ 0 ].push_back( x );
+          coords[ 1 ].push_back( y );
+          coords[ 2 ].push_back( z );
+        }
+  const unsigned int n = coords[ 0 ].size();
+  trace.info() << "P = " << P << ", " << n << " points" << std::endl;
+
+  Clock clock;
+  //curried evaluation
+  vector<double> values1( n );
+  vector<double> grads1[ 3 ];
+  for ( unsigned int k = 0; k < 3; ++k ) grads1[ k ].resize( n );
+  clock.startClock();
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      const double x = coords[ 0 ][ i ], y = coords[ 1 ][ i ], z = coords[ 2 ][ i ];
+      values1[ i ] = P( x )( y )( z );
+      for ( unsigned int k = 0; k < 3; ++k )
+        grads1[ k ][ i ] = D[ k ]( x )( y )( z );
+    }
+  double t1 = clock.stopClock();
+
+  //compiled evaluation, point by point
+  Program3 prog( P );
+  vector<double> values2( n );
+  vector<double> grads2[ 3 ];
+  for ( unsigned int k = 0; k < 3; ++k ) grads2[ k ].resize( n );
+  clock.startClock();
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      double x[ 3 ] = { coords[ 0 ][ i ], coords[ 1 ][ i ], coords[ 2 ][ i ] };
+      double grad[ 3 ];
+      values2[ i ] = prog.evalWithGradient( x, grad );
+      for ( unsigned int k = 0; k < 3; ++k )
+        grads2[ k ][ i ] = grad[ k ];
+    }
+  double t2 = clock.stopClock();
+
+  //compiled evaluation, by batch
+  vector<double> values3( n );
+  vector<double> grads3[ 3 ];
+  for ( unsigned int k = 0; k < 3; ++k ) grads3[ k ].resize( n );
+  const double* c[ 3 ] = { &coords[ 0 ][ 0 ], &coords[ 1 ][ 0 ], &coords[ 2 ][ 0 ] };
+  double* g[ 3 ] = { &grads3[ 0 ][ 0 ], &grads3[ 1 ][ 0 ], &grads3[ 2 ][ 0 ] };
+  clock.startClock();
+  prog.evalWithGradientBatch( n, c, &values3[ 0 ], g );
+  double t3 = clock.stopClock();
+
+  //values only
+  clock.startClock();
+  double total1 = 0.0;
+  for ( unsigned int i = 0; i < n; ++i )
+    total1 += P( coords[ 0 ][ i ] )( coords[ 1 ][ i ] )( coords[ 2 ][ i ] );
+  double t4 = clock.stopClock();
+  clock.startClock();
+  double total2 = 0.0;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      double x[ 3 ] = { coords[ 0 ][ i ], coords[ 1 ][ i ], coords[ 2 ][ i ] };
+      total2 += prog.eval( x );
+    }
+  double t5 = clock.stopClock();
+  clock.startClock();
+  prog.evalBatch( n, c, &values3[ 0 ] );
+  double t6 = clock.stopClock();
+
+  trace.info() << "value+gradient: curried " << t1 << " ms, program "
+               << t2 << " ms, batch " << t3 << " ms" << std::endl;
+  trace.info() << "value: curried " << t4 << " ms, program "
+               << t5 << " ms, batch " << t6 << " ms" << std::endl;
+
+  double error = 0.0, total3 = 0.0;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      double scale = 1.0 + fabs( values1[ i ] );
+      error = max( error, fabs( values2[ i ] - values1[ i ] ) / scale );
+      error = max( error, fabs( values3[ i ] - values1[ i ] ) / scale );
+      for ( unsigned int k = 0; k < 3; ++k )
+        {
+          scale = 1.0 + fabs( grads1[ k ][ i ] );
+          error = max( error, fabs( grads2[ k ][ i ] - grads1[ k ][ i ] ) / scale );
+          error = max( error, fabs( grads3[ k ][ i ] - grads1[ k ][ i ] ) / scale );
+        }
+      total3 += values3[ i ];
+    }
+  trace.info() << "max relative error = " << error << std::endl;
+  nbok += ( error < 1e-10 )
+    && ( fabs( total2 - total1 ) <= 1e-8 * ( 1.0 + fabs( total1 ) ) )
+    && ( fabs( total3 - total1 ) <= 1e-8 * ( 1.0 + fabs( total1 ) ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values and gradients" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class MPolynomialProgram" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkMPolynomialProgram( "x^3y+xz^3+y^3z+z^3+5z", 0.04 ) // Durchblick
+    && benchmarkMPolynomialProgram( "(y^2+z^2-1)^2 +(x^2+y^2-1)^3", 0.04 ); // Crixxi
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
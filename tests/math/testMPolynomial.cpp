@@ -33,6 +33,7 @@
 #include <sstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/MPolynomialProgram.h"
 #include "DGtal/io/readers/MPolynomialReader.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -229,6 +230,121 @@ bool testMPolynomialReader()
 
   return ok1 && ok2 && ok3 && ok4 && ok5 && ok6 && (!ok7);
 }
+/**
+ * Checks that [prog] gives the values and gradients of [P] at
+ * [nb] points of [-1,1]^3, one by one and by batch.
+ */
+bool checkMPolynomialProgram( const MPolynomial<3, double> & P,
+                              const MPolynomialProgram<3, double> & prog,
+                              unsigned int nb )
+{
+  MPolynomial<3, double> D[ 3 ] =
+    { derivative<0>( P ), derivative<1>( P ), derivative<2>( P ) };
+  std::vector<double> coords[ 3 ];
+  for ( unsigned int i = 0; i < nb; ++i )
+    for ( unsigned int k = 0; k < 3; ++k )
+      coords[ k ].push_back( -1.0 + 2.0 * ( ( 37 * i + 11 * k ) % 101 ) / 100.0 );
+  const double* c[ 3 ] = { &coords[ 0 ][ 0 ], &coords[ 1 ][ 0 ], &coords[ 2 ][ 0 ] };
+  std::vector<double> values( nb ), values2( nb );
+  std::vector<double> grads[ 3 ] =
+    { std::vector<double>( nb ), std::vector<double>( nb ), std::vector<double>( nb ) };
+  double* g[ 3 ] = { &grads[ 0 ][ 0 ], &grads[ 1 ][ 0 ], &grads[ 2 ][ 0 ] };
+  prog.evalBatch( nb, c, &values[ 0 ] );
+  prog.evalWithGradientBatch( nb, c, &values2[ 0 ], g );
+
+  double error = 0.0;
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      double x[ 3 ] = { coords[ 0 ][ i ], coords[ 1 ][ i ], coords[ 2 ][ i ] };
+      double grad[ 3 ];
+      double v = P( x[ 0 ] )( x[ 1 ] )( x[ 2 ] );
+      error = std::max( error, fabs( prog.eval( x ) - v ) );
+      error = std::max( error, fabs( prog.evalWithGradient( x, grad ) - v ) );
+      error = std::max( error, fabs( values[ i ] - v ) );
+      error = std::max( error, fabs( values2[ i ] - v ) );
+      for ( unsigned int k = 0; k < 3; ++k )
+        {
+          double d = D[ k ]( x[ 0 ] )( x[ 1 ] )( x[ 2 ] );
+          error = std::max( error, fabs( grad[ k ] - d ) );
+          error = std::max( error, fabs( grads[ k ][ i ] - d ) );
+        }
+    }
+  trace.info() << prog << " max error = " << error << std::endl;
+  return error < 1e-10;
+}
+
+bool testMPolynomialProgram()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing block ... compiled evaluation of mpolynomials" );
+  MPolynomial<3, double> P = durchblick<double>();
+  MPolynomialProgram<3, double> prog( P );
+  nbok += checkMPolynomialProgram( P, prog, 150 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Durchblick" << std::endl;
+
+  MPolynomialReader<3, double> reader;
+  string s = "(y^2+z^2-1)^2 +(x^2+y^2-1)^3"; // Crixxi
+  reader.read( P, s.begin(), s.end() );
+  prog.init( P );
+  nbok += checkMPolynomialProgram( P, prog, 64 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Crixxi" << std::endl;
+
+  MPolynomialProgram<3, double> zero;
+  double x[ 3 ] = { 0.5, -2.0, 3.0 };
+  nbok += ( zero.eval( x ) == 0.0 )
+    && checkMPolynomialProgram( MPolynomial<3, double>(), zero, 10 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "zero polynomial" << std::endl;
+
+  MPolynomial<2, int> f = mmonomial<int>(1, 2) + 3 * mmonomial<int>(4, 5);
+  MPolynomialProgram<2, int> progf( f );
+  int y[ 2 ] = { 4, 2 };
+  int gradf[ 2 ];
+  nbok += ( progf.evalWithGradient( y, gradf ) == 24592 )
+    && ( gradf[ 0 ] == derivative<0>( f )( 4 )( 2 ) )
+    && ( gradf[ 1 ] == derivative<1>( f )( 4 )( 2 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "f(4,2) == 24592" << std::endl;
+
+  // Interval bounds are rounded outward for doubles: they strictly
+  // contain the value at a point (a degenerate box), and the values at
+  // the points of a box. They are exact for integers.
+  prog.init( durchblick<double>() );
+  bool okInterval = true;
+  for ( unsigned int i = 0; i < 100; ++i )
+    {
+      double p[ 3 ], lo[ 3 ], up[ 3 ];
+      for ( unsigned int k = 0; k < 3; ++k )
+        {
+          p[ k ] = -1.0 + 2.0 * ( ( 37 * i + 11 * k ) % 101 ) / 100.0;
+          lo[ k ] = p[ k ] - 0.01;
+          up[ k ] = p[ k ] + 0.01;
+        }
+      const double v = prog.eval( p );
+      double vlo, vup;
+      prog.evalInterval( p, p, vlo, vup );
+      okInterval = okInterval && ( vlo < v ) && ( v < vup );
+      prog.evalInterval( lo, up, vlo, vup );
+      okInterval = okInterval && ( vlo <= v ) && ( v <= vup );
+    }
+  int vlof, vupf;
+  progf.evalInterval( y, y, vlof, vupf );
+  nbok += okInterval && ( vlof == 24592 ) && ( vupf == 24592 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "outward rounded intervals" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -238,7 +354,8 @@ int main( int /*argc*/, char** /*argv*/ )
 
   bool res = testMPolynomial()
     //&& testMPolynomialSpeed( 0.01 )
-    && testMPolynomialReader();
+    && testMPolynomialReader()
+    && testMPolynomialProgram();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,164 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeasure-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/07/04
+ *
+ * Benchmark of the measure and of the centroid (on 'a') of random
+ * convex polygons, polygon by polygon and by the batch evaluation of
+ * MeasureOfStraightLines over a packed polygon soup.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/math/MeasureOfStraightLines.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class MeasureOfStraightLines.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Appends to a packed polygon soup a random convex polygon of the
+ * half-plane a > 0, with at most [maxNb] vertices, counter-clockwise.
+ */
+void addRandomConvexPolygon( vector<unsigned int> & offsets,
+                             vector<double> & a, vector<double> & b,
+                             unsigned int maxNb )
+{
+  const unsigned int nb = 3 + rand() % ( maxNb - 2 );
+  const double ca = 0.5 + 4.0 * rand() / (double) RAND_MAX;
+  const double cb = -2.0 + 4.0 * rand() / (double) RAND_MAX;
+  const double r = 0.01 + 0.4 * rand() / (double) RAND_MAX;
+  vector<double> angles( nb );
+  for ( unsigned int i = 0; i < nb; ++i )
+    angles[ i ] = 2.0 * M_PI * rand() / ( (double) RAND_MAX + 1.0 );
+  sort( angles.begin(), angles.end() );
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      a.push_back( ca + r * cos( angles[ i ] ) );
+      b.push_back( cb + r * sin( angles[ i ] ) );
+    }
+  offsets.push_back( a.size() );
+}
+
+bool benchmarkMeasure( unsigned int nbPolygons, unsigned int maxNb )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Benchmarking measures of random convex polygons" );
+  srand( 0 );
+  vector<unsigned int> offsets( 1, 0 );
+  vector<double> a, b;
+  for ( unsigned int k = 0; k < nbPolygons; ++k )
+    addRandomConvexPolygon( offsets, a, b, maxNb );
+  trace.info() << nbPolygons << " polygons, " << a.size() << " vertices" 
+               << std::endl;
+
+  MeasureOfStraightLines measure;
+  Clock clock;
+  // polygon by polygon
+  vector<double> measures1( nbPolygons ), centroids1( nbPolygons );
+  clock.startClock();
+  for ( unsigned int k = 0; k < nbPolygons; ++k )
+    {
+      vector<double> pa( a.begin() + offsets[ k ], a.begin() + offsets[ k + 1 ] );
+      vector<double> pb( b.begin() + offsets[ k ], b.begin() + offsets[ k + 1 ] );
+      measures1[ k ] = measure.computeMeasure( pa, pb );
+    }
+  double t1 = clock.stopClock();
+  clock.startClock();
+  for ( unsigned int k = 0; k < nbPolygons; ++k )
+    {
+      vector<double> pa( a.begin() + offsets[ k ], a.begin() + offsets[ k + 1 ] );
+      vector<double> pb( b.begin() + offsets[ k ], b.begin() + offsets[ k + 1 ] );
+      centroids1[ k ] = measure.computeCentroidA( pa, pb );
+    }
+  double t2 = clock.stopClock();
+
+  // batch
+  vector<double> measures2, measures3, centroids3;
+  clock.startClock();
+  measure.computeMeasures( offsets, a, b, measures2 );
+  double t3 = clock.stopClock();
+  clock.startClock();
+  measure.computeCentroidsA( offsets, a, b, measures3, centroids3 );
+  double t4 = clock.stopClock();
+  clock.startClock();
+  measure.computeCentroidsA( offsets, a, b, measures3, centroids3, 0 );
+  double t5 = clock.stopClock();
+
+  trace.info() << "measure: polygon by polygon " << t1 << " ms, batch " 
+               << t3 << " ms" << std::endl;
+  trace.info() << "measure and centroid on a: polygon by polygon " << t1 + t2 
+               << " ms, batch " << t4 << " ms, " << t5 
+               << " ms (all threads)" << std::endl;
+
+  double errM = 0, errC = 0;
+  for ( unsigned int k = 0; k < nbPolygons; ++k )
+    {
+      errM = max( errM, fabs( measures2[ k ] - measures1[ k ] ) / measures1[ k ] );
+      errM = max( errM, fabs( measures3[ k ] - measures1[ k ] ) / measures1[ k ] );
+      errC = max( errC, fabs( centroids3[ k ] - centroids1[ k ] ) / centroids1[ k ] );
+    }
+  trace.info() << "max relative errors: measure " << errM 
+               << ", centroid on a " << errC << std::endl;
+  // computeMeasureEdge and computeCentroidEdge_a lose up to 1e-4
+  // (relative) on the smallest polygons, by cancellation.
+  nbok += ( errM < 1e-3 ) && ( errC < 1e-3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same measures and centroids" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class MeasureOfStraightLines" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkMeasure( 1000000, 6 ) 
+    && benchmarkMeasure( 100000, 64 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,8 @@
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <algorithm>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/MeasureOfStraightLines.h"
 
@@ -97,6 +99,113 @@ void testUnitSquareCentroid()
 }
 
 
+/**
+ * Appends to a packed polygon soup a random convex polygon of the
+ * half-plane a > 0, counter-clockwise.
+ */
+void addRandomConvexPolygon( vector<unsigned int> & offsets,
+                             vector<double> & a, vector<double> & b )
+{
+  const unsigned int nb = 3 + rand() % 10;
+  const double ca = 0.5 + 4.0 * rand() / (double) RAND_MAX;
+  const double cb = -2.0 + 4.0 * rand() / (double) RAND_MAX;
+  const double r = 0.01 + 0.4 * rand() / (double) RAND_MAX;
+  vector<double> angles( nb );
+  for ( unsigned int i = 0; i < nb; ++i )
+    angles[ i ] = 2.0 * M_PI * rand() / ( (double) RAND_MAX + 1.0 );
+  sort( angles.begin(), angles.end() );
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      a.push_back( ca + r * cos( angles[ i ] ) );
+      b.push_back( cb + r * sin( angles[ i ] ) );
+    }
+  offsets.push_back( a.size() );
+}
+
+/**
+ * Compare the batch evaluation over a packed polygon soup with the
+ * evaluation of each polygon.
+ **/
+bool testBatch()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing batch evaluation over a polygon soup" );
+  srand( 0 );
+  vector<unsigned int> offsets( 1, 0 );
+  vector<double> a, b;
+  // unit square, then a triangle with a vertical edge and a vertex
+  // on the 'b' axis, then random convex polygons.
+  double sa[] = { 0, 1, 1, 0 };
+  double sb[] = { 0, 0, 1, 1 };
+  a.insert( a.end(), sa, sa + 4 );
+  b.insert( b.end(), sb, sb + 4 );
+  offsets.push_back( a.size() );
+  double ta[] = { 0, 2, 2 };
+  double tb[] = { 0, -1, 1 };
+  a.insert( a.end(), ta, ta + 3 );
+  b.insert( b.end(), tb, tb + 3 );
+  offsets.push_back( a.size() );
+  for ( unsigned int k = 0; k < 1000; ++k )
+    addRandomConvexPolygon( offsets, a, b );
+
+  MeasureOfStraightLines measure;
+  vector<double> measures, measures2, centroidsA;
+  measure.computeMeasures( offsets, a, b, measures );
+  measure.computeCentroidsA( offsets, a, b, measures2, centroidsA, 0 );
+  double errM = 0, errC = 0;
+  for ( unsigned int k = 0; k + 1 < offsets.size(); ++k )
+    {
+      vector<double> pa( a.begin() + offsets[ k ], a.begin() + offsets[ k + 1 ] );
+      vector<double> pb( b.begin() + offsets[ k ], b.begin() + offsets[ k + 1 ] );
+      double m = measure.computeMeasure( pa, pb );
+      double c = measure.computeCentroidA( pa, pb );
+      errM = max( errM, fabs( measures[ k ] - m ) / m );
+      errM = max( errM, fabs( measures2[ k ] - m ) / m );
+      errC = max( errC, fabs( centroidsA[ k ] - c ) / c );
+    }
+  trace.info() << "Unit square: measure " << measures[ 0 ] 
+               << ", centroid on a " << centroidsA[ 0 ] << std::endl;
+  trace.info() << "Max relative errors: measure " << errM 
+               << ", centroid on a " << errC << std::endl;
+  nbok += ( fabs( measures[ 0 ] - sqrt( 2.0 ) / 2.0 ) < 1e-12 )
+    && ( fabs( centroidsA[ 0 ] - 0.414214 ) < 1e-6 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "unit square" << std::endl;
+  // computeMeasureEdge loses about 1e-8 (relative) on small
+  // polygons, by cancellation.
+  nbok += ( errM < 1e-7 ) && ( errC < 1e-7 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "batch evaluation == computeMeasure and computeCentroidA" 
+               << std::endl;
+
+  // empty polygons, alone or around the square, in output vectors
+  // holding previous values.
+  vector<unsigned int> emptyOffsets( 3, 0 );
+  measure.computeCentroidsA( emptyOffsets, vector<double>(), vector<double>(), 
+                             measures, centroidsA );
+  bool okEmpty = ( measures.size() == 2 ) && ( measures[ 1 ] == 0 ) 
+    && ( centroidsA.size() == 2 ) && ( centroidsA[ 1 ] == 0 );
+  unsigned int so[] = { 0, 0, 4, 4, 4 };
+  vector<unsigned int> squareOffsets( so, so + 5 );
+  vector<double> squareA( sa, sa + 4 ), squareB( sb, sb + 4 );
+  measure.computeCentroidsA( squareOffsets, squareA, squareB, measures, centroidsA );
+  okEmpty = okEmpty && ( measures.size() == 4 ) && ( measures[ 0 ] == 0 ) 
+    && ( fabs( measures[ 1 ] - sqrt( 2.0 ) / 2.0 ) < 1e-12 )
+    && ( measures[ 2 ] == 0 ) && ( measures[ 3 ] == 0 )
+    && ( centroidsA[ 0 ] == 0 ) && ( centroidsA[ 3 ] == 0 );
+  nbok += okEmpty ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "empty polygons" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
 int main(int argc, char **argv)
 {
   trace.beginBlock ( "Testing class MeasureOfStraightLines" );
@@ -107,10 +216,12 @@ int main(int argc, char **argv)
   
   testUnitSquare();
   testUnitSquareCentroid();
+  bool res = testBatch();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   
   trace.endBlock();
   
-  return 0;
+  return res ? 0 : 1;
 }
 
 /** @ingroup Tests **/
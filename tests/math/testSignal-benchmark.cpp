@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSignal-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/07/02
+ *
+ * Benchmark of the direct and FFT-based convolutions of Signal, for
+ * signals and kernels of various sizes, in order to check the
+ * crossover chosen by Signal::operator*.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/math/Signal.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class Signal.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+   Convolves a signal of size \a n by a kernel of size \a m, by the
+   direct and the FFT-based convolutions, each one being repeated
+   until it lasts at least 100 ms.
+
+   @return 'true' iff both convolutions agree and operator* picked
+   the fastest one or one at most 50% slower.
+*/
+bool benchmarkConvolution( unsigned int n, unsigned int m, bool periodic )
+{
+  vector<double> f( n ), g( m );
+  for ( unsigned int i = 0; i < n; ++i ) f[ i ] = ( random() % 1000 ) / 100.0;
+  for ( unsigned int i = 0; i < m; ++i ) g[ i ] = ( random() % 1000 ) / 1000.0;
+  Signal<double> F( &f[ 0 ], n, 0, periodic, 0.0 );
+  Signal<double> G( &g[ 0 ], m, m / 2, false, 0.0 );
+
+  Clock clock;
+  Signal<double> R1, R2;
+  unsigned int nb1 = 0, nb2 = 0;
+  double t1 = 0.0, t2 = 0.0;
+  clock.startClock();
+  do { R1 = F.directConvolution( G ); ++nb1; t1 = clock.stopClock(); }
+  while ( t1 < 100.0 );
+  clock.startClock();
+  do { R2 = F.fftConvolution( G ); ++nb2; t2 = clock.stopClock(); }
+  while ( t2 < 100.0 );
+  t1 /= nb1;
+  t2 /= nb2;
+
+  double error = 0.0, scale = 1.0;
+  for ( unsigned int i = 0; i < R1.size(); ++i )
+    {
+      error = max( error, fabs( R1[ i ] - R2[ i ] ) );
+      scale = max( scale, fabs( R1[ i ] ) );
+    }
+  bool fft = Signal<double>::isFFTConvolutionFaster( n, m, periodic );
+  double chosen = fft ? t2 : t1;
+  trace.info() << ( periodic ? "periodic " : "         " )
+               << "n=" << n << " m=" << m
+               << " direct " << t1 << " ms, fft " << t2 << " ms"
+               << ", operator* uses " << ( fft ? "fft" : "direct" )
+               << ", rel. error " << error / scale << std::endl;
+  return ( error <= 1e-10 * scale ) && ( chosen <= 1.5 * min( t1, t2 ) + 0.01 );
+}
+
+bool benchmarkSignal()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Benchmarking direct and FFT convolutions" );
+  srandom( 0 );
+  unsigned int sizes[] = { 256, 4096, 65536 };
+  unsigned int kernels[] = { 8, 16, 32, 64, 128, 256, 1024, 4096 };
+  for ( unsigned int in = 0; in < 3; ++in )
+    for ( unsigned int im = 0; im < 8; ++im )
+      for ( int p = 0; p < 2; ++p )
+        if ( kernels[ im ] <= sizes[ in ] )
+          {
+            nbok += benchmarkConvolution( sizes[ in ], kernels[ im ], p == 1 ) 
+              ? 1 : 0;
+            nb++;
+          }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same convolutions, operator* picks a fast one" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class Signal" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkSignal();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Signal.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -79,6 +82,110 @@ bool testSignal()
 }
 
 
+/**
+   Convolution product as defined by Signal::operator*, through the
+   protected accesses of Signal::operator[].
+*/
+Signal<double> referenceConvolution( const Signal<double> & F, 
+                                     const Signal<double> & G,
+                                     int Fzero, int Gzero, bool periodic,
+                                     double def )
+{
+  const int n = F.size();
+  const int m = G.size();
+  if ( periodic )
+    {
+      Signal<double> FG( n, Fzero, true, def );
+      for ( int a = 0; a < n; ++a )
+        {
+          double sum = 0.0;
+          for ( int i = 0; i < m; ++i )
+            sum += F[ a - ( i - Gzero ) ] * G[ i - Gzero ];
+          FG[ a ] = sum;
+        }
+      return FG;
+    }
+  Signal<double> FG( n + m - 1, Fzero + Gzero, false, def );
+  for ( int a = 0; a < n + m - 1; ++a )
+    {
+      double sum = 0.0;
+      for ( int i = 0; i < m; ++i )
+        sum += F[ a - Fzero - i ] * G[ i - Gzero ];
+      FG[ a - Fzero - Gzero ] = sum;
+    }
+  return FG;
+}
+
+double maxDifference( const Signal<double> & S1, const Signal<double> & S2 )
+{
+  if ( S1.size() != S2.size() ) return 1.0e300;
+  double d = 0.0;
+  for ( int i = -2 * (int) S1.size(); i < 2 * (int) S1.size(); ++i )
+    d = std::max( d, std::fabs( S1[ i ] - S2[ i ] ) );
+  return d;
+}
+
+bool testConvolutions()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing block: direct and FFT convolutions" );
+  srandom( 0 );
+  unsigned int sizes[] = { 1, 2, 7, 64, 100, 257 };
+  for ( unsigned int in = 0; in < 6; ++in )
+    for ( unsigned int im = 0; im < 6; ++im )
+      for ( int p = 0; p < 2; ++p )
+        {
+          const int n = sizes[ in ];
+          const int m = sizes[ im ];
+          const bool periodic = ( p == 1 );
+          const int Fzero = random() % ( 2 * n ) - n / 2;
+          const int Gzero = random() % m;
+          const double def = periodic ? 0.0 : 0.5;
+          std::vector<double> f( n ), g( m );
+          for ( int i = 0; i < n; ++i ) f[ i ] = ( random() % 1000 ) / 100.0 - 5.0;
+          for ( int i = 0; i < m; ++i ) g[ i ] = ( random() % 1000 ) / 1000.0;
+          Signal<double> F( &f[ 0 ], n, Fzero, periodic, def );
+          Signal<double> G( &g[ 0 ], m, Gzero, false, 0.0 );
+          Signal<double> R = referenceConvolution( F, G, Fzero, Gzero, 
+                                                   periodic, def );
+          double d1 = maxDifference( R, F.directConvolution( G ) );
+          double d2 = maxDifference( R, F.fftConvolution( G ) );
+          double d3 = maxDifference( R, F * G );
+          bool ok = ( d1 < 1e-9 ) && ( d2 < 1e-9 ) && ( d3 < 1e-9 );
+          if ( ! ok )
+            trace.info() << "n=" << n << " m=" << m << " periodic=" << periodic
+                         << " direct=" << d1 << " fft=" << d2 
+                         << " operator*=" << d3 << std::endl;
+          nbok += ok ? 1 : 0; 
+          nb++;
+        }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "direct and FFT convolutions == reference" << std::endl;
+  Signal<double> G = Signal<double>::G2();
+  Signal<double> H = Signal<double>::H2();
+  bool ok = true;
+  for ( unsigned int k = 2; k < 40; ++k )
+    {
+      G = referenceConvolution( G, Signal<double>::G2(), 
+                                k - 1, 1, false, 0.0 );
+      H = referenceConvolution( H, Signal<double>::H2(), 
+                                k - 1, 1, false, 0.0 );
+      ok = ok && ( maxDifference( G, Signal<double>::G2n( k ) ) 
+                   <= 1e-15 )
+        && ( maxDifference( H, Signal<double>::H2n( k ) ) 
+             <= 1e-15 * H[ 0 ] );
+    }
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "G2n and H2n == repeated convolutions" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -90,7 +197,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testSignal();
+  bool res = testSignal() && testConvolutions();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
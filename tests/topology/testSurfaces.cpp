@@ -0,0 +1,190 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaces.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2012/06/22
+ *
+ * Functions for testing the extraction of all the contours of a 2D
+ * shape in class Surfaces.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/curves/representation/FreemanChain.h"
+#include "DGtal/geometry/curves/representation/PackedFreemanChain.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the extraction of all the contours of a 2D shape.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Sorts the elements of each contour, then the contours,
+ * so that contours given in any order and from any element
+ * may be compared.
+ */
+template <typename T>
+void normalize( vector< vector<T> > & contours )
+{
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    sort( contours[ i ].begin(), contours[ i ].end() );
+  sort( contours.begin(), contours.end() );
+}
+
+/**
+ * Rank of a surfel in the scan of scanAll2DSCellContours: surfels
+ * orthogonal to the first axis, then to the second one, each in
+ * raster order of the spel they follow.
+ */
+DGtal::int64_t scanRank( const KSpace & ks, const SCell & s, 
+                         const Point & low, const Point & up )
+{
+  const DGtal::int64_t width = up[ 0 ] - low[ 0 ] + 1;
+  const DGtal::int64_t height = up[ 1 ] - low[ 1 ] + 1;
+  Dimension orth = ks.sOrthDir( s );
+  Point q = ks.uCoords( ks.uIncident( ks.unsigns( s ), orth, false ) );
+  if ( ( q[ 0 ] < low[ 0 ] ) || ( q[ 0 ] > up[ 0 ] )
+       || ( q[ 1 ] < low[ 1 ] ) || ( q[ 1 ] > up[ 1 ] ) )
+    return 2 * width * height;
+  return orth * width * height + ( q[ 1 ] - low[ 1 ] ) * width + ( q[ 0 ] - low[ 0 ] );
+}
+
+bool testScanAllContours( bool interior )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( string( "Testing scanAll2DSCellContours, " )
+                     + ( interior ? "interior" : "exterior" ) + " adjacency" );
+
+  //disks, a ring, and a square touching the bounds
+  Point low( -10, -8 ), up( 40, 25 );
+  Domain domain( low, up );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      Point p = *it;
+      int d1 = ( p[ 0 ] - 2 ) * ( p[ 0 ] - 2 ) + ( p[ 1 ] - 3 ) * ( p[ 1 ] - 3 );
+      int d2 = ( p[ 0 ] - 22 ) * ( p[ 0 ] - 22 ) + ( p[ 1 ] - 10 ) * ( p[ 1 ] - 10 );
+      if ( ( d1 <= 30 ) || ( ( d2 <= 64 ) && ( d2 >= 12 ) )
+           || ( ( p[ 0 ] >= 33 ) && ( p[ 1 ] >= 18 ) )
+           || ( ( p[ 0 ] == 10 ) && ( p[ 1 ] == -2 ) )
+           || ( ( p[ 0 ] == 11 ) && ( p[ 1 ] == -1 ) ) )
+        set.insertNew( p );
+    }
+  SetPredicate<DigitalSet> pred( set );
+  KSpace ks;
+  ks.init( low, up, true );
+  SurfelAdjacency<2> sAdj( interior );
+
+  vector< vector<SCell> > ref, res;
+  Surfaces<KSpace>::extractAll2DSCellContours( ref, ks, sAdj, pred );
+  Surfaces<KSpace>::scanAll2DSCellContours( res, ks, sAdj, pred );
+  trace.info() << ref.size() << " contours" << std::endl;
+  bool flag = ( ref.size() == res.size() );
+  for ( unsigned int i = 0; ( i < res.size() ) && flag; ++i )
+    flag = ! res[ i ].empty();
+  //contours in the order of their first scanned surfel
+  bool ordered = true;
+  DGtal::int64_t previous = -1;
+  for ( unsigned int i = 0; ( i < res.size() ) && flag; ++i )
+    {
+      DGtal::int64_t first = scanRank( ks, res[ i ].front(), low, up );
+      for ( unsigned int j = 1; j < res[ i ].size(); ++j )
+        first = std::min( first, scanRank( ks, res[ i ][ j ], low, up ) );
+      ordered = ordered && ( previous < first );
+      previous = first;
+    }
+  nbok += ( flag && ordered ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "contours in raster-scan order" << std::endl;
+  normalize( ref );
+  normalize( res );
+  nbok += ( flag && ( ref == res ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same contours of surfels" << std::endl;
+
+  vector< vector<Point> > refPoints, resPoints;
+  Surfaces<KSpace>::extractAllPointContours4C( refPoints, ks, pred, sAdj );
+  Surfaces<KSpace>::scanAllPointContours4C( resPoints, ks, pred, sAdj );
+  flag = ( refPoints.size() == resPoints.size() );
+  //packed chains from the contours of points
+  for ( unsigned int i = 0; ( i < resPoints.size() ) && flag; ++i )
+    {
+      PackedFreemanChain<int> pc( resPoints[ i ] );
+      vector<Point> points;
+      pc.getPoints( back_inserter( points ) );
+      flag = ( points == resPoints[ i ] )
+        && ( pc.unpack() == FreemanChain<int>( resPoints[ i ] ) );
+    }
+  //the first point of a closed contour is repeated at its end
+  for ( unsigned int i = 0; i < refPoints.size(); ++i )
+    if ( refPoints[ i ].front() == refPoints[ i ].back() )
+      refPoints[ i ].pop_back();
+  for ( unsigned int i = 0; i < resPoints.size(); ++i )
+    if ( resPoints[ i ].front() == resPoints[ i ].back() )
+      resPoints[ i ].pop_back();
+  normalize( refPoints );
+  normalize( resPoints );
+  nbok += ( flag && ( refPoints == resPoints ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same contours of points, packed chains" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class Surfaces" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testScanAllContours( true )
+    && testScanAllContours( false ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////